@@ -85,5 +85,7 @@ def getRobotTypeName(robot_type): # function to get name for passed in robot typ
         return "Greedy"
     elif robot_type == 2:
         return "FCFS"
+    elif robot_type == 6:
+        return "Batch"
     else:
         return ""
\ No newline at end of file
@@ -5,6 +5,7 @@ import shutil
 from PIL import Image, ImageDraw, ImageFont
 
 # simple python script to convert a series of maze text files into a .gif image
+# printouts are rendered from a simulation's Frames.bin using: Multi-Agent_Maze_Simulator --export-printouts <dir>
 
 parser = argparse.ArgumentParser() # parsing argument for target simulation directory
 parser.add_argument("dir")
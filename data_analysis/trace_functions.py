@@ -0,0 +1,56 @@
+import json
+import os
+import numpy as np
+
+# layout of a trace written by the simulator, see include/RequestTrace.h
+
+trace_header_dtype = np.dtype([("magic", "S4"), ("version", "<u4"), ("record_size", "<u4"), ("number_of_turns", "<u4")])
+
+trace_record_dtype = np.dtype([("turn", "<u4"),
+                               ("transaction", "<u4"),
+                               ("robot_id", "<u4"), # assigned id for addRobot requests
+                               ("current_x", "<i4"),
+                               ("current_y", "<i4"),
+                               ("target_x", "<i4"),
+                               ("target_y", "<i4"),
+                               ("path_length", "<u4"),
+                               ("type", "i1"),
+                               ("walls", "u1"), # 1 = north, 2 = south, 4 = east, 8 = west
+                               ("flags", "u1"), # 1 = has response, 2 = movement occured / cell reserved / target found
+                               ("unused", "u1")])
+
+def loadRequestTrace(trace_directory): # maps a trace into numpy arrays without reading it into memory
+                                       # returns info json, records, paths as (n, 2) array of x, y pairs and index of each record's path within paths
+    info_file = open(os.path.join(trace_directory, "Trace_Info.json"))
+    info = json.load(info_file)
+
+    requests_file = os.path.join(trace_directory, "Trace_Requests.bin")
+    header = np.fromfile(requests_file, dtype=trace_header_dtype, count=1)[0]
+
+    if header["magic"] != b"MRTR" or header["version"] != 1 or header["record_size"] != trace_record_dtype.itemsize:
+        raise ValueError(requests_file + " is not a compatible trace")
+
+    if os.path.getsize(requests_file) > trace_header_dtype.itemsize:
+        records = np.memmap(requests_file, dtype=trace_record_dtype, mode="r", offset=trace_header_dtype.itemsize)
+    else: # numpy cannot map an empty file
+        records = np.zeros(0, dtype=trace_record_dtype)
+
+    paths_file = os.path.join(trace_directory, "Trace_Paths.bin")
+    if os.path.getsize(paths_file) > 0:
+        paths = np.memmap(paths_file, dtype="<i4", mode="r").reshape(-1, 2)
+    else:
+        paths = np.zeros((0, 2), dtype="<i4")
+
+    path_starts = np.concatenate(([0], np.cumsum(records["path_length"], dtype=np.int64)[:-1])) if len(records) > 0 else np.zeros(0, dtype=np.int64)
+
+    return info, records, paths, path_starts
+
+def getNumberofCellsScannedFromTrace(trace_directory): # number of updateGlobalMap requests sent by each robot, read from a trace instead of Simulation.json
+    info, records, paths, path_starts = loadRequestTrace(trace_directory)
+
+    num_robots = info["Info"]["Number_of_Robots"]
+
+    scans = records[records["type"] == 1] # updateGlobalMap requests
+    cells_scan_operations = np.bincount(scans["robot_id"], minlength=num_robots + 1)[1:] # robot ids start from 1
+
+    return cells_scan_operations, range(1, num_robots + 1)
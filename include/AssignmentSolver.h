@@ -0,0 +1,15 @@
+#ifndef ASSIGNMENTSOLVER_H
+#define ASSIGNMENTSOLVER_H
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+#define NO_ASSIGNMENT_COST 1000000000 // cost used for pairs which cannot be assigned (e.g. cell cannot be reached by robot)
+
+std::vector<int> solveAssignment(const std::vector<std::vector<int>>* cost); // finds assignment of rows to columns with lowest total cost using the hungarian algorithm
+                                                                            // every row of cost must be the same length
+                                                                            // returns column assigned to each row, -1 if row is unassigned or only NO_ASSIGNMENT_COST columns were left
+                                                                            // O(n^2 m) for n rows and m columns
+
+#endif
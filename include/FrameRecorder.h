@@ -0,0 +1,141 @@
+#ifndef FRAMERECORDER_H
+#define FRAMERECORDER_H
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+#include "GridGraph.h"
+#include "Coordinates.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// Frame File Layout
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+// FRAMES_FILE holds a FrameHeader, then a block for every frame, then a FrameIndexEntry for every frame
+// a keyframe block holds the number of robots, the position of every robot as x, y pairs of int32 and every row of the map's planes
+//     (node low bits, node high bits, x edges then y edges, as stored by GridGraph)
+// a delta block holds the number of changes followed by a FrameChange for every cell and robot which changed since the previous frame
+// a keyframe is written once the changes since the last keyframe outnumber the cells of the map, so a file grows with the number of changes rather than the number of frames
+// every value is written in the byte order of the machine, which is little endian on every supported platform
+
+#define FRAMES_FILE "Frames.bin"
+
+#define FRAME_VERSION 1
+
+// types of FrameChange
+#define fc_Node 0 // node x, y of map changed to value
+#define fc_XEdge 1 // x edge x of row y changed to value
+#define fc_YEdge 2 // y edge x of row y changed to value
+#define fc_Robot 3 // robot robot_id moved to x, y, NULL_COORDINATE once robot has been removed
+
+struct FrameHeader{ // first bytes of FRAMES_FILE
+    char magic[4]; // "MRFR"
+    uint32_t version; // FRAME_VERSION
+    int32_t x_size; // size of map
+    int32_t y_size;
+    uint32_t number_of_frames; // written once recorder is closed
+    uint32_t unused;
+    uint64_t index_offset; // offset of first FrameIndexEntry, written once recorder is closed
+};
+
+struct FrameChange{ // a single change between two frames, 16 bytes with no padding
+    int32_t x;
+    int32_t y;
+    uint32_t robot_id; // id of robot moved by fc_Robot, 0 otherwise
+    uint8_t type; // fc_ type of change
+    uint8_t value; // new node state or wall
+    uint16_t unused;
+};
+
+struct FrameIndexEntry{ // location of a frame within FRAMES_FILE
+    uint64_t offset; // offset of frame's block
+    uint32_t turn; // turn frame was recorded on
+    uint32_t keyframe; // frame number of keyframe frame is built from, equal to frame number if frame is a keyframe
+};
+
+static_assert(sizeof(FrameHeader) == 32 && sizeof(FrameChange) == 16 && sizeof(FrameIndexEntry) == 16, "Frame layouts must match frame readers");
+
+struct Frame{ // state of GlobalMap and robots on a recorded turn
+    int frame_number; // -1 until a frame has been read
+    unsigned int turn;
+    GridGraph Map;
+    std::vector<Coordinates> robot_positions; // indexed by robot id - 1, NULL_COORDINATE once robot has been removed
+
+    Frame(){
+        frame_number = -1;
+        turn = 0;
+    }
+};
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// FrameRecorder Class
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+class FrameRecorder{ // records GlobalMap and robot positions of each turn as changes since the previous turn
+                     // the previous frame is held as a bit plane copy of GlobalMap so changes are found a 64 bit word at a time
+    public:
+        // ** FrameRecorder Constructors **
+        FrameRecorder(std::string directory, int x_size, int y_size); // creates FRAMES_FILE in directory, which must end in '/'
+        ~FrameRecorder(); // closes recorder if close has not been called
+
+        // ** Record Functions **
+        bool isOpen() { return frames_open; } // false if frame file could not be created
+        void recordFrame(unsigned int turn, const GridGraph* Map, const std::vector<Coordinates>* robot_positions, bool map_changed); // map_changed can be false if Map is unchanged since last frame
+        unsigned int getNumberofFrames() { return index.size(); }
+        void close(); // writes index and closes frame file
+
+    private:
+        void writeKeyframe(const GridGraph* Map, const std::vector<Coordinates>* robot_positions);
+        void findMapChanges(const GridGraph* Map); // adds a FrameChange for every node and edge which differs from last_map
+        void findRobotChanges(const std::vector<Coordinates>* robot_positions); // adds a FrameChange for every robot which moved since last frame
+
+        std::ofstream frame_stream;
+        bool frames_open;
+
+        GridGraph last_map; // map of last recorded frame
+        std::vector<Coordinates> last_positions; // robot positions of last recorded frame
+        std::vector<FrameChange> changes; // changes of frame being recorded, reused every frame
+        std::vector<FrameIndexEntry> index;
+
+        uint64_t changes_since_keyframe;
+        uint32_t last_keyframe;
+};
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// FrameReader Class
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+class FrameReader{ // reconstructs any frame of a file written by FrameRecorder
+    public:
+        // ** FrameReader Constructors **
+        FrameReader(std::string directory); // directory must end in '/'
+
+        // ** Read Functions **
+        bool isOpen() { return frames_open; } // false if frame file is missing, incomplete or was written by an incompatible version
+        unsigned int getNumberofFrames() { return index.size(); }
+        int getXSize() { return x_size; }
+        int getYSize() { return y_size; }
+        bool readFrame(unsigned int frame_number, Frame* F); // reconstructs frame_number (starting from 0) into F, false if frame does not exist
+                                                             // if F holds an earlier frame built from the same keyframe only the changes in between are applied, so reading frames in order is cheap
+
+    private:
+        void readKeyframe(unsigned int frame_number, Frame* F);
+        void applyChanges(unsigned int frame_number, Frame* F);
+
+        std::ifstream frame_stream;
+        bool frames_open;
+
+        int x_size;
+        int y_size;
+        std::vector<FrameIndexEntry> index;
+        std::vector<FrameChange> changes; // changes of frame being applied, reused every frame
+};
+
+std::string printFrame(Frame* F); // renders frame in the same format as RobotMaster::printGlobalMap, a cell holding several robots shows the lowest id
+bool exportFramePrintOuts(std::string directory); // writes printouts/printout_<n>.txt for every frame of FRAMES_FILE in directory
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef FRAMERENDERER_H
+#define FRAMERENDERER_H
+
+#include <string>
+
+#include "FrameRecorder.h"
+#include "ImageEncoders.h"
+
+#define RENDER_CELL_SIZE 6 // default number of pixels per cell, including one wall
+#define RENDER_GIF_DELAY 4 // hundredths of a second each frame of a gif is shown for, about 24 frames a second
+#define RENDER_CHUNK_SIZE 32 // number of consecutive frames rendered by a task, only the first of which is drawn from scratch
+#define RENDER_GIF_FILE "maze_exploration.gif"
+#define RENDER_FRAMES_DIRECTORY "frames/" // png and ppm frames are written to frame_<n> within this directory, starting from 1
+
+// palette indexes used by rendered frames
+#define rc_Explored 0
+#define rc_Wall 1
+#define rc_Unseen 2
+#define rc_Seen 3 // seen but not explored
+#define rc_Robot 4 // first robot color, robots cycle through every color from rc_Robot up to GIF_TRANSPARENT by id
+
+extern const PaletteColor render_palette[PALETTE_SIZE];
+
+class FrameRenderer{ // rasterises GlobalMap and robot positions of a Frame into a PaletteImage
+                     // a wall is one pixel wide and each cell has cell_size - 1 pixels of floor, so images are x_size*cell_size + 1 pixels wide
+                     // a gap in a wall takes the color of the cell owning the wall, so every pixel other than a corner belongs to exactly one cell
+    public:
+        // ** FrameRenderer Constructors **
+        FrameRenderer(int x_size, int y_size, int cell_size);
+
+        // ** Render Functions **
+        void renderFrame(const Frame* F, PaletteImage* Image); // only reads from renderer, so frames can be rendered by several threads at once
+        void renderChanges(const Frame* F, const Frame* Previous, PaletteImage* Image); // Image must hold render of Previous, only cells which differ in F are drawn again
+        int getWidth() { return x_size*cell_size + 1; }
+        int getHeight() { return y_size*cell_size + 1; }
+
+    private:
+        void drawCell(const GridGraph* Map, int x, int y, PaletteImage* Image); // draws floor of cell and the walls it owns (northern and western, plus southern and eastern along the border of the maze)
+        void drawRobot(unsigned int robot_id, Coordinates C, PaletteImage* Image);
+        uint8_t getNodeColor(const GridGraph* Map, int x, int y);
+
+        int x_size;
+        int y_size;
+        int cell_size;
+};
+
+bool renderFrames(std::string directory, int image_format, int cell_size, int num_of_threads); // renders every frame of FRAMES_FILE in directory as an if_ image format, false if frames could not be read or written
+                                                                                               // frames are read in order and rendered and encoded in parallel batches, num_of_threads of 0 uses one thread per hardware thread
+
+#endif
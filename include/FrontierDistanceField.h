@@ -0,0 +1,71 @@
+#ifndef FRONTIERDISTANCEFIELD_H
+#define FRONTIERDISTANCEFIELD_H
+
+#include <vector>
+#include <deque>
+#include <algorithm>
+
+#include "GridGraph.h"
+#include "Coordinates.h"
+#include "WavefrontBFS.h"
+
+class FrontierDistanceField{ // distance from every explored cell of a map to its closest frontier cell
+                             // every unexplored cell (state 2) which is not excluded is a source, distances travel through explored cells (state 1) only
+                             // this matches the cells a robot is able to plan through on its LocalMap
+                             // each cell remembers which source it was reached from, so removing a source only resets the cells it reached
+                             // those cells are then repaired from the cells bordering them instead of recomputing the whole field
+                             // field must be notified of every change to the map using cellChanged, walls are expected to only ever be removed
+                             // whole field is built with the bit-parallel WavefrontBFS, updates are spread from changed cells with a queue bucketed by distance
+    public:
+        // ** FrontierDistanceField Constructors **
+        FrontierDistanceField(const GridGraph* map);
+
+        // ** Maintenance Functions **
+        void rebuild(); // rebuilds entire field from map, distances are found by Wavefront and owners are then taken from a neighbour one closer to a source
+        void cellChanged(int x, int y); // updates field after state or walls of a cell have changed
+        void setExcludedCells(const std::vector<Coordinates>* cells); // unexplored cells which must not be sources (e.g. cells reserved by a robot)
+                                                                      // replaces previously excluded cells
+
+        // ** Query Functions **
+        int getDistance(Coordinates C) { return distance[toIndex(C.x, C.y)]; } // distance to closest frontier cell, -1 if none can be reached
+        bool getPathToFrontier(Coordinates start, std::deque<Coordinates>* path); // follows field down to closest frontier cell
+                                                                                  // path contains every cell after start up to and including frontier cell
+        int getCellsUpdated() { return cells_updated; } // number of cells whose distance was set during last update
+
+    private:
+        // ** Cell Rules **
+        int toIndex(int x, int y) { return y*x_size + x; }
+        Coordinates toCoordinates(int i) { return Coordinates(i % x_size, i / x_size); }
+        void loadLinks(int i); // reads which sides of cell have no wall from map
+        int getConnectedNeighbours(int i, int* neighbours); // gathers neighbours with no wall between them and cell into neighbours (size 4), returns number gathered
+        bool shouldBeSource(int i); // unexplored and not excluded
+        bool isSource(int i) { return owner[i] == i; }
+        bool isExplored(int i) { return Map->getNode(i % x_size, i / x_size) == 1; }
+
+        // ** Update Functions **
+        void updateCell(int i); // updates a single cell and spreads any resulting changes
+        void resetRegion(int source, std::vector<int>* reset_cells); // clears every cell which was reached from source
+        void queueNeighbours(int i); // queues every connected neighbour of cell with a known distance
+        void relaxFromNeighbours(int i); // sets distance of cell from its closest neighbour with a known distance
+        void queueCell(int i, int d); // queues cell to be spread from at distance d
+        void propagate(); // spreads queued distances outwards until no cell can be improved
+
+        const GridGraph* Map;
+        int x_size;
+        int y_size;
+
+        WavefrontBFS Wavefront; // bit-parallel search used by rebuild
+
+        std::vector<int> distance; // distance of each cell to its closest source, -1 if unknown
+        std::vector<int> owner; // source each cell was reached from, -1 if unknown
+        std::vector<char> excluded; // cells which are not allowed to be sources
+        std::vector<Coordinates> excluded_cells; // list of excluded cells so they can be replaced
+
+        std::vector<unsigned char> links; // sides of each cell with no wall (1 = north, 2 = south, 4 = east, 8 = west), kept up to date by cellChanged
+
+        std::vector<std::vector<int>> update_buckets; // cells waiting to be spread, indexed by distance they were queued with
+        int first_bucket; // no bucket below this holds a queued cell
+        int cells_updated;
+};
+
+#endif
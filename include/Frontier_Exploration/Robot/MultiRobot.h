@@ -18,6 +18,8 @@ class MultiRobot: public Robot{
 
         MultiRobot(int x, int y, RequestHandler* r, unsigned int xsize, unsigned int ysize); // constructor for multi-robot exploration purposes
         virtual ~MultiRobot(); // virtual destructor to ensure child destructor is called during "delete" to base class pointer
+
+        bool hasMessagesFromMaster() { return Master_2_Robot_Message_Handler->getNumberofMessages() > 0; } // whether master has sent messages robot has not yet handled
        
     protected:
         // protected functions:
@@ -27,7 +29,7 @@ class MultiRobot: public Robot{
 
         // ** General Purpose Functions **
         unsigned int getID() { return id;} // returns robot id
-        void updateLocalMap(std::vector<Coordinates>* map_info, std::vector<std::vector<bool>>* edge_info, std::vector<char>* map_status); // updates robot's map with information from vectors
+        void updateLocalMap(const MessagePayload* map); // updates robot's map with portion of map held by payload
 
         // ** Robot -> Master Communication Functions **
         void assignIdFromMaster(); // gets an ID from a RobotMaster using a message
@@ -51,6 +53,9 @@ class MultiRobot: public Robot{
         int transaction_counter; // counts the number of sent transactions executed
                                  // also used to assign transation id to sent messages to allow for response identification
 
+        int job_epoch; // number of targets master has given robot through setTargetCell requests, sent with every request
+                       // master ignores requests sent with an older epoch as they were sent before robot received its latest target
+
         std::vector<int> valid_responses; // vector to track id of transactions which require a response
                                           // if a response is recieved that is not tracked in here, it must be stale
 
@@ -62,7 +67,10 @@ class MultiRobot: public Robot{
                                  // will be set to false if RobotMaster has told robot to shutdown
 
         RequestHandler* Robot_2_Master_Message_Handler; // pointer to request handler shared by all Robot objects
+        RequestHandler::MessageChannel* Robot_2_Master_Channel; // channel of robot within Robot_2_Master_Message_Handler, opened by constructor
         RequestHandler* Master_2_Robot_Message_Handler;
+
+        std::vector<Message> received_messages; // messages taken from Master_2_Robot_Message_Handler by getMessagesFromMaster, reused every turn
 }; 
 
 #endif
\ No newline at end of file
@@ -20,6 +20,8 @@ class MultiRobot_CellReservation: virtual public MultiRobot{
         // ** Robot -> Master Communication Functions **
         void requestReserveCell(); // attempts to reserve a cell to explore from the RobotMaster
                                    // if cell to reserve fails, LocalMap is updated with GlobalMap information
+        bool requestFrontierTarget(); // asks RobotMaster to reserve the closest unreserved cell if fs_MasterField is selected
+                                      // returns false if robot must search its LocalMap for a cell to reserve instead
 
         // ** Master -> Robot Communication Stub Functions **
         int handleCellReserveResponse(Message* response, int current_status); // handles response for collision messages
@@ -29,6 +31,8 @@ class MultiRobot_CellReservation: virtual public MultiRobot{
         
         std::vector <Coordinates> already_reserved_cells; // vector with cells that are already reserved by other robots
                                                           // ensures robot will attempt to reserve next closest unreserved cell
+
+        bool local_search_required; // set if RobotMaster could not find a cell so next search uses LocalMap
 };
 
 #endif
\ No newline at end of file
@@ -2,7 +2,9 @@
 #define ROBOTMASTER_H
 
 #include <vector>
+#include <deque>
 #include <map>
+#include <unordered_map>
 #include <string.h>
 #include <iostream>
 #include <fmt/format.h>
@@ -11,6 +13,11 @@
 #include "GridGraph.h"
 #include "Coordinates.h"
 #include "RequestHandler.h"
+#include "PathfindingWorkspace.h"
+#include "PathPlanner.h"
+#include "TreeDistanceOracle.h"
+#include "FrontierDistanceField.h"
+#include "RequestTrace.h"
 
 #include "nlohmann/json.hpp" // using json.hpp from https://github.com/nlohmann/json
                              // this library is used to export tracked data into a json format
@@ -33,6 +40,9 @@ struct RobotInfo{ // structure to track information of various robots in the swa
     bool robot_moving; // boolean to determine whether a robot is in the process of moving to a cell
 
     Coordinates robot_target; // target frontier cell which the robot is travelling to
+
+    int job_epoch; // number of targets master has given robot through setTargetCell requests
+                   // requests carrying an older epoch were sent before the robot received its latest target, so their reservations and movements no longer match it and are ignored
 };
 
 class RobotMaster{ // abstract base class for all supervisor implementations
@@ -45,29 +55,42 @@ class RobotMaster{ // abstract base class for all supervisor implementations
         void robotMasterSetUp(); // function to initialize RobotMaster before receiving requests
         bool receiveRequests();  // recieves and decodes request information from imcoming request
                                  // returns false until all cells have been explored
+        bool receiveAllRequests(unsigned int turn); // recieves every request sent so far and handles them as one batch (e.g. once per turn)
+                                                    // robots' requests are handled starting from a different robot each turn, order depends only on turn so engines which skip turns give identical results
+                                                    // returns false until all cells have been explored
         // ** print functions **
         void printRequestInfo(Message* Request); // prints information on outcome of receieve request
         std::string printGlobalMap(); // prints global map with robot locations
 
         // ** setters and getters **
         void setGlobalMap(GridGraph* g); // sets global map with new map value 
+        void setPathPlanner(int planner_type); // selects algorithm used for point to point searches on GlobalMap (pp_BFS or pp_AStar)
+        void enableDistanceOracle(); // maintains a tree distance oracle of GlobalMap which is used for distance queries between known cells
+        void enableFrontierField(); // maintains distances from explored cells of GlobalMap to their closest frontier cell, allocated on first getFrontierTarget request
         GridGraph* getGlobalMap() { return GlobalMap; } // gets global map
         
         // ** General Purpose Functions **
         int getNumRequestsinQueue(){ return Message_Handler->getNumberofMessages(); } // returns number of requests in RobotMaster's Queue
+        unsigned int getNumberofMapChanges() { return num_of_map_changes; } // number of changes made to GlobalMap so far, a simulation where this stops increasing is making no progress
         int getNumberofRobots() { return num_of_robots; } // gets number of robots added to the system
+        void getRobotPositions(std::vector<Coordinates>* positions); // fills positions with position of every robot added so far indexed by robot id - 1, NULL_COORDINATE once robot has been removed
 
         // ** Metric Tracking Functions **
-        json getRequestInfo(){ return RequestInfo; } // gets a copy of the json containing information on transactions handled by the RobotMaster class
-        void clearRequestInfo(){ RequestInfo.clear(); } // clears the contents of the RequestInfo json
+        json getRequestInfo(){ return Request_Trace.toJSON(); } // gets a json containing information on transactions handled by the RobotMaster class
+        void clearRequestInfo(){ Request_Trace.clear(); } // clears the records of transactions handled
+        RequestTrace* getRequestTrace() { return &Request_Trace; } // records of transactions handled, can be swapped out by a TraceWriter
+        void setRequestTracing(bool enabled) { trace_requests = enabled; } // requests are traced by default, disabling tracing leaves request handlers with only exploration work
 
 
     protected:
         // protected functions:
 
         // ** Supervisor Stub Operation Functions **
+        bool handleRequest(Message* request); // handles a single received request, returns true once all robots have shut down
         virtual void handleIncomingRequest(Message* m) = 0; // processes all requests except shutdown notifications
                                                             // varies depending on implemented functions
+        virtual void handleQueuedRequests() { return; } // called each time every received request has been handled (e.g. once at the end of each turn)
+                                                        // allows child classes to hold requests and answer them together
         // ** Request Handling Functions **
         // these are effectively wrapper stub functions for other functions to unpack data for implemented funtions
         void shutDownRequest(Message* request); // calls a function to remove a robot from the syste
@@ -80,7 +103,8 @@ class RobotMaster{ // abstract base class for all supervisor implementations
         virtual unsigned int addRobot(unsigned int x, unsigned int y, RequestHandler* r); // adds robots to tracked_robots t
                                                                                           // this is important to allow for the robot to be synchronized by the control system
         void removeRobot(unsigned int robot_id); // removes robot from tracked_robots
-        virtual void updateGlobalMap(unsigned int* id, std::vector<bool>* connections, Coordinates* C); // updates global map with information from robot scan
+                                                 // RobotInfo of removed robot is kept so pointers to it remain valid
+        virtual void updateGlobalMap(unsigned int* id, const bool* connections, Coordinates* C); // updates global map with information from robot scan
         virtual void updateRobotLocation(unsigned int* id, Coordinates* C); // updates the location of a robot to the location specified
         
         // ** Order message functions **
@@ -91,28 +115,53 @@ class RobotMaster{ // abstract base class for all supervisor implementations
         // ** General Purpose Functions **  
         RequestHandler* getTargetRequestHandler(unsigned int target_id); // gets a request handler for a specific robot
         RobotInfo* getRobotInfo(unsigned int id); // gets pointer to robot info of a robot based on its id
+        int startNewJob(RobotInfo* robot); // marks every request robot has sent so far as stale, returns robot's new job epoch to send with its new target
+                                           // must be called when master gives robot a target its pending requests do not know about
+        bool isRequestStale(Message* request, unsigned int robot_id) { return request->job_epoch != getRobotInfo(robot_id)->job_epoch; } // true if request was sent before robot received its latest target
+
+        // ** Robot Index Functions **
+        // every change to a robot's position or target must be made through these functions so lookups by cell stay in sync
+        void setRobotPosition(RobotInfo* robot, Coordinates C); // moves robot to cell in cell_occupants
+        void setRobotTarget(RobotInfo* robot, Coordinates C); // sets target of robot in reserved_targets, NULL_COORDINATE clears target
+        RobotInfo* getRobotInCell(Coordinates C, unsigned int ignored_id = 0); // gets a robot occupying cell other than ignored_id, NULL if none
+        RobotInfo* getRobotTargetingCell(Coordinates C, unsigned int ignored_id = 0); // gets a robot whose target is cell other than ignored_id, NULL if none
+        int cellIndex(Coordinates C) { return C.y*maze_xsize + C.x; } // row-major index of cell used by cell_occupants and reserved_targets
 
         // ** Printing Functions **
         bool checkIfOccupied(unsigned int x, unsigned int y, unsigned int* ret_variable); // checks if a cell is occupied by a robot
                                                                                           // this is used for printing
         // ** GlobalMap Functions **
         // these functions utilise the global map in one form or another
-        void gatherPortionofMap(Coordinates curr_node, Coordinates neighbour_node, std::vector<Coordinates>* map_nodes, std::vector<std::vector<bool>>* map_connections, std::vector<char>* node_status); // generates portion of map to be transfered to robot using two final vectors as return values 
+        void gatherPortionofMap(Coordinates curr_node, Coordinates neighbour_node, MessagePayload* map); // generates portion of map to be transfered to robot, adding it to map of payload
         std::vector<Coordinates> getSeenNeighbours(unsigned int x, unsigned  int y); // Gets explored and seen neighbours to a node      
-        std::vector<bool> getNodeEdgeInfo(Coordinates* C); // gets connection information surrounding a node
-                                                           // [0] = north edge
-                                                           // [1] = south edge
-                                                           // [2] = east edge
-                                                           // [3] = west edge
+        void globalMapCellChanged(int x, int y); // notifies Frontiers that a cell or its walls have changed on GlobalMap
+        int getKnownDistance(Coordinates a, Coordinates b); // length of shortest path between cells on GlobalMap, -1 if no path is known
+                                                            // answered by Oracle if enabled and GlobalMap is still a tree, otherwise Planner is used
+        void addMapCell(Coordinates C, MessagePayload* map); // adds coordinates, walls and status of a node to map of payload
+                                                             // walls are added in order north, south, east, west
         // ** Metric Tracking Functions **
-        void exportRequestInfo2JSON(m_genericRequest* request, m_genericRequest* response, unsigned int request_id); // exports information regarding a recieved request to a json file
+        void exportRequestInfo2Trace(const MessageData& request, const MessagePayload* request_payload, const MessageData* response, const MessagePayload* response_payload, unsigned int request_id){ // records information regarding a recieved request in Request_Trace
+                                                                                                                                                                                                    // must be called before response is sent as receiver can release its payload once sent
+            if(trace_requests){ // inline so handlers only test a flag when tracing is disabled
+                Request_Trace.addRequest(request, request_payload, response, response_payload, request_id);
+            }
+        }
         void clearTargetCell(unsigned int* robot_id); // removes target cell from robot
 
         // protected data members:
 
         GridGraph* GlobalMap; // Supervisor's Global Map of maze
 
-        std::vector<RobotInfo> tracked_robots; // vector to track information on various robots within maze
+        PathfindingWorkspace Workspace; // parent array and queue reused by every search on GlobalMap
+        PathPlanner* Planner; // planner used to find paths between two known cells on GlobalMap
+        TreeDistanceOracle* Oracle; // distance oracle of GlobalMap connections, NULL unless enabled
+        FrontierDistanceField* Frontiers; // distances to closest unreserved frontier cell shared by all robots, NULL unless enabled
+
+        std::vector<RobotInfo*> tracked_robots; // robots currently within maze in the order they were added
+                                                // entries point into robot_slots
+        std::vector<std::vector<unsigned int>> cell_occupants; // ids of robots occupying each cell of the maze in row-major order
+        std::unordered_map<int, std::vector<unsigned int>> reserved_targets; // ids of robots targeting a cell, keyed by row-major index of cell
+                                                                             // cells which are not a target of any robot have no entry
         
         int number_of_frontier_cells; // number of unexplored cells encountered by Robots
 
@@ -120,6 +169,8 @@ class RobotMaster{ // abstract base class for all supervisor implementations
                                  // exploration won't begin until enough robots have been added
 
         unsigned int num_of_receieve_transactions; // tracks the number of incoming transactions handled
+
+        unsigned int num_of_map_changes; // number of times a cell or its walls have changed on GlobalMap
         
         bool accepting_requests; // boolean to track whether robotmaster is receiving requests
                                  // true = accept requests, false = ignore all requests except shut down request
@@ -127,7 +178,14 @@ class RobotMaster{ // abstract base class for all supervisor implementations
             RequestHandler* Message_Handler; // pointer to request handler shared by all Robots and a RobotMaster objects
                                              // private as all messaging handling done by stub functions
 
-            json RequestInfo; // json containing information regarding each request
+            RequestTrace Request_Trace; // records of each request handled since trace was last cleared
+            bool trace_requests; // whether handled requests are added to Request_Trace
+
+            std::vector<Message> request_batch; // requests taken from Message_Handler by receiveAllRequests, reused every batch
+
+            std::deque<RobotInfo> robot_slots; // RobotInfo of every robot added, indexed by robot id - 1
+                                               // entries are never erased and a deque never moves existing entries when growing
+            std::vector<RobotInfo*> robot_lookup; // RobotInfo of each tracked robot indexed by robot id - 1, NULL once robot has been removed
 
             unsigned int num_of_added_robots = 0; // counter to track number of robots added to system
 
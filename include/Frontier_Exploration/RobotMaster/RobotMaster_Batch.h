@@ -0,0 +1,61 @@
+#ifndef ROBOTMASTER_BATCH_H
+#define ROBOTMASTER_BATCH_H
+
+#include "RobotMaster_CellReservation.h"
+#include "AssignmentSolver.h"
+
+#define BATCH_LABELS_PER_CELL 2 // number of groups of waiting robots each cell is offered to
+                                // robots further from a cell than this many others are unlikely to be assigned anything beyond it
+
+class RobotMaster_Batch: virtual public RobotMaster_CellReservation{ // child class for batch assignment strategy
+                                                                     // getFrontierTarget requests are held until every request of a turn has been handled
+                                                                     // frontier cells are then assigned to all waiting robots together so their total distance to travel is lowest
+                                                                     // distances are found by a single search from every waiting robot, with each cell only offered to the robots closest to it
+                                                                     // a reserved cell is only given to a waiting robot closer to it than the robot holding it, which is then told to find a new target
+                                                                     // a robot which is not assigned a cell keeps waiting and is considered again once GlobalMap or the waiting robots change
+    protected:
+        RobotMaster_Batch();
+        ~RobotMaster_Batch();
+
+        // ** Request Handling Functions **
+        void queueFrontierTargetRequest(Message* request); // holds getFrontierTarget request until all requests have been handled
+        void handleQueuedRequests(); // assigns frontier cells to every held request and sends responses
+
+        // ** Request Functions **
+        void handleAlreadyReservedCell(RobotInfo* current_robot, RobotInfo* reserving_robot, const MessageVector<Coordinates>* requested_path, m_reserveCellResponse* response_data, Coordinates target_cell); // robot which reserved cell first keeps it
+
+    private:
+        struct SearchEntry{ // cell reached by the shared search on behalf of one group of waiting robots
+            int cell; // indexed by Workspace
+            int group; // waiting robots in the same cell share a group
+            int distance; // distance from group's cell
+            int parent; // position within search_entries of entry this cell was reached from, -1 for group's own cell
+        };
+
+        // ** Assignment Functions **
+        void gatherClosestFrontierCells(int max_cells); // breadth first search through explored cells of GlobalMap from every group at once for their closest frontier cells
+        bool labelCell(int cell, int group); // offers cell to group, returns false if group has already reached it or cell has been offered to enough groups
+        bool isCandidateCell(int cell, int distance); // whether frontier cell can be assigned to a robot at distance from it
+        void getPathFromSearch(int entry, std::deque<Coordinates>* path); // follows parents of search from entry back to its group's cell
+                                                                         // path contains every cell after group's cell up to and including the entry's cell
+
+        struct QueuedRequest{ // getFrontierTarget request waiting to be assigned a cell
+            m_getFrontierTargetRequest request_data; // copy of request data as message is deleted once handled
+            int transaction_id; // transaction id of request message, used for response
+            unsigned int receive_transaction; // number of request when it was received, used for tracking json
+            int job_epoch; // job epoch request was sent with, request is dropped if robot is given a target another way while waiting
+        };
+
+        std::vector<QueuedRequest> queued_requests;
+        bool queue_changed; // whether a request has been queued since cells were last assigned
+        unsigned int map_changes_at_last_assignment; // number of GlobalMap changes when cells were last assigned
+        std::vector<int> group_of_request; // group of each held request
+        std::vector<int> group_cells; // cell of each group, indexed by Workspace
+        std::vector<std::vector<int>> group_frontiers; // positions within search_entries of frontier cells found by each group, closest first
+
+        std::vector<int> holder_distance; // distance of holding robot to each reserved cell, -1 if cell is not reserved, indexed by Workspace
+        std::vector<SearchEntry> search_entries; // every cell reached by search in the order it was reached, also used as search queue
+        std::vector<int> cell_labels; // groups each cell has been offered to, BATCH_LABELS_PER_CELL slots per cell, -1 if slot is unused
+};
+
+#endif
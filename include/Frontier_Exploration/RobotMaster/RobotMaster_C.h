@@ -18,7 +18,7 @@ class RobotMaster_C: virtual public RobotMaster{
                                               // gives the robot the opportunity to create a path to a new target cell
 
         // ** Request Functions **
-        void gatherMap2Target(Coordinates current_node, Coordinates target_node, std::vector<Coordinates>* map_nodes, std::vector<std::vector<bool>>* map_connections, std::vector<char>* node_status); // gahters a portion of the map from robot position to target
+        void gatherMap2Target(Coordinates current_node, Coordinates target_node, MessagePayload* map); // gahters a portion of the map from robot position to target
 
         // ** General Purpose Functions **  
         RobotInfo* checkForCollision(Coordinates* movement_cell, unsigned int robot_id); // checks if there a collision between passed robot and any other robot. Returns pointer robotinfo of collision causing robot
@@ -0,0 +1,15 @@
+#ifndef ROBOTMASTER_C_BATCH_H
+#define ROBOTMASTER_C_BATCH_H
+
+#include "RobotMaster_Batch.h"
+#include "RobotMaster_C.h"
+
+class RobotMaster_C_Batch: public RobotMaster_Batch, public RobotMaster_C{
+    public:
+        RobotMaster_C_Batch(RequestHandler* r, int num_of_robots, unsigned int xsize, unsigned int ysize);
+        ~RobotMaster_C_Batch();
+
+        void handleIncomingRequest(Message* m); // processes all requests except shutdown notifications
+};
+
+#endif
\ No newline at end of file
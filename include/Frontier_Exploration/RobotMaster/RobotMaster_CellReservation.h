@@ -11,14 +11,20 @@ class RobotMaster_CellReservation: virtual public RobotMaster{ // class which ou
         // ** Request Handling Functions **
         // these are effectively wrapper stub functions for other functions to unpack data for implemented funtions
         void reserveCellRequest(Message* request); // handles reserve cell request from a robot
+        void getFrontierTargetRequest(Message* request); // reserves closest unreserved frontier cell to a robot using Frontiers
+                                                         // replaces robot searching its own LocalMap for a cell to reserve
         
         // ** Request Functions **
         // these are the actual implemented functions used by stub wrapper functions
-        void reserveCell(RobotInfo* robot_info, std::deque<Coordinates>* path_2_target , Coordinates target_cell); // function to reserve a cell in child classes
-        virtual void handleAlreadyReservedCell(RobotInfo* current_robot, RobotInfo* reserving_robot, m_reserveCellRequest* request_data, m_reserveCellResponse* response_data, Coordinates target_cell) = 0; // handles the case where a cell is already reserved by another robot
+        void reserveCell(RobotInfo* robot_info, const MessageVector<Coordinates>* path_2_target , Coordinates target_cell); // function to reserve a cell in child classes
+        virtual void handleAlreadyReservedCell(RobotInfo* current_robot, RobotInfo* reserving_robot, const MessageVector<Coordinates>* requested_path, m_reserveCellResponse* response_data, Coordinates target_cell) = 0; // handles the case where a cell is already reserved by another robot
                                                                                                                                                                                                              // function which is to be implemented in child classes 
         // ** General Purpose Functions **  
+        void sendFrontierTargetResponse(m_getFrontierTargetRequest* request_data, int transaction_id, unsigned int receive_transaction, std::deque<Coordinates>* path_2_target); // reserves last cell of path for robot and sends path with map information
+                                                                                                                                                                                // an empty path tells robot no cell was found
+        void clearRobotTarget(RobotInfo* robot_info); // clears target and planned path of a robot which is searching for a new target
         RobotInfo* isCellReserved(Coordinates* target_cell, unsigned int robot_id); // checks if cell is already a target of another robot using parent's "tracked_robots" vector
+        void updateReservedFrontierCells(); // excludes every robot's target cell from Frontiers
 };
 
 #endif
\ No newline at end of file
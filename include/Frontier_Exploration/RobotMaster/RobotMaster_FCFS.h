@@ -8,7 +8,7 @@ class RobotMaster_FCFS: virtual public RobotMaster_CellReservation{ // child cla
         RobotMaster_FCFS();
         ~RobotMaster_FCFS();
 
-        void handleAlreadyReservedCell(RobotInfo* current_robot, RobotInfo* reserving_robot, m_reserveCellRequest* request_data, m_reserveCellResponse* response_data, Coordinates target_cell); // implementation of FCFS strategy
+        void handleAlreadyReservedCell(RobotInfo* current_robot, RobotInfo* reserving_robot, const MessageVector<Coordinates>* requested_path, m_reserveCellResponse* response_data, Coordinates target_cell); // implementation of FCFS strategy
 };
 
 #endif
\ No newline at end of file
@@ -8,7 +8,7 @@ class RobotMaster_Greedy: virtual public RobotMaster_CellReservation{ // child c
         RobotMaster_Greedy();
         ~RobotMaster_Greedy();
         
-        void handleAlreadyReservedCell(RobotInfo* current_robot, RobotInfo* reserving_robot, m_reserveCellRequest* request_data, m_reserveCellResponse* response_data, Coordinates target_cell); // implementation of greedy strategy
+        void handleAlreadyReservedCell(RobotInfo* current_robot, RobotInfo* reserving_robot, const MessageVector<Coordinates>* requested_path, m_reserveCellResponse* response_data, Coordinates target_cell); // implementation of greedy strategy
 };
 
 #endif
\ No newline at end of file
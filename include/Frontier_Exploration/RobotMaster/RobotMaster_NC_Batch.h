@@ -0,0 +1,14 @@
+#ifndef ROBOTMASTER_NC_BATCH_H
+#define ROBOTMASTER_NC_BATCH_H
+
+#include "RobotMaster_Batch.h"
+
+class RobotMaster_NC_Batch: public RobotMaster_Batch{
+    public:
+        RobotMaster_NC_Batch(RequestHandler* r, int num_of_robots, unsigned int xsize, unsigned int ysize);
+        ~RobotMaster_NC_Batch();
+
+        void handleIncomingRequest(Message* m); // processes all requests except shutdown notifications
+};
+
+#endif
\ No newline at end of file
@@ -3,34 +3,111 @@
 
 #include <iostream>
 #include <vector>
+#include <cstdint>
 
-struct GridGraph{
-    std::vector<std::vector<char>> nodes; // Nodes represent each cell within the maze
-                                          // values for usage as Maze
-                                          // 0 = node not apart of maze
-                                          // 1 = node apart of maze
-                                          // values for usage as Map
-                                          // 0 = invalid node
-                                          // 1 = explored valid node
-                                          // 2 =  unexplored valid node
-                                                     
-    std::vector<std::vector<bool>> x_edges; // bit matrix corresponding to y (east-west) edges of nodes in maze
-                                            // false = no wall
-                                            // true = wall 
-
-    std::vector<std::vector<bool>> y_edges; // bit matrix corresponding to y (north-south) edges of nodes in maze
-                                            // false = no wall
-                                            // true = wall 
-
-    GridGraph(){ //  creating empty GridGraph
-                 // need to allocate various vectors manually
-    }
-
-    GridGraph(int x, int y){ // x = x length of graph, y = y length of graph
-        nodes.resize(y,std::vector<char>(x, 0)); // allocating vectors to empty matrix of specified size 
-        x_edges.resize(y,std::vector<bool>(x+1, false));
-        y_edges.resize(y+1,std::vector<bool>(x, false));
-    }
+struct GridGraph{ // contiguous row-major storage of a maze or a map of a maze
+                  // every row of every plane is padded to a whole number of 64 bit words
+                  // this allows bit-parallel kernels to operate on a full row of cells at a time
+    public:
+        // ** GridGraph Constructors **
+        GridGraph(){ //  creating empty GridGraph
+            x_size = 0;
+            y_size = 0;
+            row_words = 0;
+        }
+
+        GridGraph(int x, int y){ // x = x length of graph, y = y length of graph
+            x_size = x;
+            y_size = y;
+            row_words = (x + 1 + 63)/64; // x edges need one more bit than nodes per row, all planes share the same row width
+
+            node_low.assign(row_words*y, 0); // allocating planes to empty matrix of specified size
+            node_high.assign(row_words*y, 0);
+            x_edges.assign(row_words*y, 0);
+            y_edges.assign(row_words*(y + 1), 0);
+        }
+
+        // ** Node Accessors **
+        // values for usage as Maze
+        // 0 = node not apart of maze
+        // 1 = node apart of maze
+        // values for usage as Map
+        // 0 = invalid node
+        // 1 = explored valid node
+        // 2 = unexplored valid node
+        // 3 = explored node leading to a dead end (robot maps only)
+        char getNode(int x, int y) const{
+            unsigned int i = y*row_words + (x >> 6); // index of word containing node
+            unsigned int b = x & 63; // bit of node within word
+
+            return (char)(((node_low[i] >> b) & 1) | (((node_high[i] >> b) & 1) << 1)); // combining both bit planes into node state
+        }
+
+        void setNode(int x, int y, char state){
+            unsigned int i = y*row_words + (x >> 6); // index of word containing node
+            uint64_t mask = 1ULL << (x & 63); // bit of node within word
+
+            node_low[i] = (state & 1) ? (node_low[i] | mask) : (node_low[i] & ~mask); // writing low bit of state
+            node_high[i] = (state & 2) ? (node_high[i] | mask) : (node_high[i] & ~mask); // writing high bit of state
+        }
+
+        // ** Edge Accessors **
+        // x edges are the east-west walls of a node, y edges are the north-south walls of a node
+        // false = no wall
+        // true = wall
+        bool getXEdge(int x, int y) const { return getBit(x_edges, x, y); } // x edge x of row y (x = 0 to x_size)
+        bool getYEdge(int x, int y) const { return getBit(y_edges, x, y); } // y edge x of row y (y = 0 to y_size)
+        void setXEdge(int x, int y, bool wall){ setBit(x_edges, x, y, wall); }
+        void setYEdge(int x, int y, bool wall){ setBit(y_edges, x, y, wall); }
+
+        void setAllEdges(bool wall){ // places or removes every wall in the graph
+            for(int y = 0; y < y_size; y++)
+                for(int x = 0; x < x_size + 1; x++)
+                    setXEdge(x, y, wall);
+
+            for(int y = 0; y < y_size + 1; y++)
+                for(int x = 0; x < x_size; x++)
+                    setYEdge(x, y, wall);
+        }
+
+        // ** Size Getters **
+        int getXSize() const { return x_size; }
+        int getYSize() const { return y_size; }
+
+        // ** Raw Row Accessors **
+        // used by bit-parallel kernels which process 64 cells per word
+        // bit x of word (x >> 6) within a row corresponds to column x
+        int getRowWords() const { return row_words; } // number of 64 bit words per row
+        const uint64_t* getNodeLowRow(int y) const { return &node_low[y*row_words]; } // low bit plane of node states
+        const uint64_t* getNodeHighRow(int y) const { return &node_high[y*row_words]; } // high bit plane of node states
+        const uint64_t* getXEdgeRow(int y) const { return &x_edges[y*row_words]; }
+        const uint64_t* getYEdgeRow(int y) const { return &y_edges[y*row_words]; }
+        uint64_t* getNodeLowRow(int y) { return &node_low[y*row_words]; } // writable rows, used when loading whole rows from a file
+        uint64_t* getNodeHighRow(int y) { return &node_high[y*row_words]; }
+        uint64_t* getXEdgeRow(int y) { return &x_edges[y*row_words]; }
+        uint64_t* getYEdgeRow(int y) { return &y_edges[y*row_words]; }
+
+    private:
+        bool getBit(const std::vector<uint64_t>& plane, int x, int y) const{
+            return (plane[y*row_words + (x >> 6)] >> (x & 63)) & 1;
+        }
+
+        void setBit(std::vector<uint64_t>& plane, int x, int y, bool value){
+            uint64_t& word = plane[y*row_words + (x >> 6)];
+            uint64_t mask = 1ULL << (x & 63);
+
+            word = value ? (word | mask) : (word & ~mask);
+        }
+
+        int x_size; // number of nodes in a row
+        int y_size; // number of rows
+        int row_words; // number of 64 bit words used to store one row of any plane
+
+        std::vector<uint64_t> node_low;  // bit planes storing 2 bit node states
+        std::vector<uint64_t> node_high; // state = low | (high << 1)
+
+        std::vector<uint64_t> x_edges; // bit matrix corresponding to x (east-west) edges of nodes in maze, x_size + 1 bits per row
+        std::vector<uint64_t> y_edges; // bit matrix corresponding to y (north-south) edges of nodes in maze, y_size + 1 rows
 };
 
 // print function declarations
@@ -38,4 +115,4 @@ void printXEdges(GridGraph* m);
 void printYEdges(GridGraph* m);
 void printNodes(GridGraph* m);
 
-#endif
\ No newline at end of file
+#endif
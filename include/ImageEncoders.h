@@ -0,0 +1,51 @@
+#ifndef IMAGEENCODERS_H
+#define IMAGEENCODERS_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// image formats which can be encoded
+#define if_GIF 0 // animated gif of every frame
+#define if_PNG 1 // one png per frame
+#define if_PPM 2 // one binary ppm per frame
+
+#define PALETTE_SIZE 16 // number of colors a PaletteImage can use, small enough for gif codes to start at 5 bits
+#define GIF_TRANSPARENT (PALETTE_SIZE - 1) // palette index gif frames use for pixels unchanged since previous frame, so must not be used by images encoded as gif
+
+struct PaletteColor{
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+};
+
+struct PaletteImage{ // image whose pixels are indexes into a palette of PALETTE_SIZE colors
+    int width;
+    int height;
+    std::vector<uint8_t> pixels; // palette index of every pixel in row-major order
+
+    PaletteImage(){
+        width = 0;
+        height = 0;
+    }
+
+    void resize(int w, int h){
+        width = w;
+        height = h;
+        pixels.resize((size_t)w*h);
+    }
+};
+
+// every encoder appends to out, so a caller can reuse one buffer between images
+void encodePPM(const PaletteImage* Image, const PaletteColor* palette, std::vector<uint8_t>* out); // binary (P6) ppm
+void encodePNG(const PaletteImage* Image, const PaletteColor* palette, std::vector<uint8_t>* out); // 8 bit palette png, compressed with runs and repeated rows of pixels
+                                                                                                   // no compression library is needed as mazes are made of long runs of a few colors
+
+void encodeGIFHeader(int width, int height, const PaletteColor* palette, std::vector<uint8_t>* out); // header, palette and looping extension of an animated gif
+void encodeGIFFrame(const PaletteImage* Image, const PaletteImage* Previous, int delay, std::vector<uint8_t>* out); // frame shown for delay hundredths of a second
+                                                                                                                    // only the rectangle which differs from Previous is encoded, with unchanged pixels left transparent, Previous can be NULL for first frame
+void encodeGIFTrailer(std::vector<uint8_t>* out);
+
+bool writeFile(std::string file_name, const std::vector<uint8_t>* data); // false if file could not be written
+
+#endif
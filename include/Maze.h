@@ -8,13 +8,17 @@
 
 #include "GridGraph.h"
 #include "Coordinates.h"
+#include "MazeGenerator.h"
 
 class Maze
 {
     public:
         void generate4x4SampleMaze(); // generates the sample 4x4 maze
         void generate8x8SampleMaze(); // generates the sample 8x8 maze
-        void generateRandomNxNMaze(unsigned int x_size, unsigned int y_size); // generates a random NxN maze using Aldous-Broder Maze generation Algorithm
+        void generateRandomNxNMaze(unsigned int x_size, unsigned int y_size); // generates a random NxN maze using Aldous-Broder Maze generation Algorithm (mg_AldousBroder)
+        void generateRandomNxNMaze(unsigned int x_size, unsigned int y_size, unsigned int seed); // generates the same random NxN maze every time for a given seed
+        bool generateRandomNxNMaze(unsigned int x_size, unsigned int y_size, unsigned int seed, int generator_type); // generates maze with a mg_ generator type, false if type is unknown
+        bool loadMazeFile(std::string file_name); // loads maze saved by writeMazeFile or --generate-maze, false if file could not be read
         
         GridGraph getMazeMap(); // MazeMap getter
         GridGraph* getMazeMapPointer(); // returns pointer to MazeMap
@@ -0,0 +1,93 @@
+#ifndef MAZEGENERATOR_H
+#define MAZEGENERATOR_H
+
+#include <vector>
+#include <string>
+#include <random>
+#include <functional>
+#include <cstdint>
+
+#include "GridGraph.h"
+#include "Coordinates.h"
+
+// maze generator types, every generator carves a perfect maze (exactly one path between any two cells)
+#define mg_AldousBroder 0 // random walk over whole grid, uniform but needs many times more steps than there are cells
+                          // default so seeds of earlier experiments give the same mazes
+#define mg_Wilson 1 // loop-erased random walks, uniform like Aldous-Broder while visiting each cell only a few times
+#define mg_Backtracker 2 // randomised depth first search, long winding corridors with few junctions
+#define mg_Eller 3 // one row at a time, can stream rows to a maze file using memory proportional to the width of the maze
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// Maze File Layout
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+// a maze file holds a MazeFileHeader, then the y edges of row 0 (northern border), then the x edges of row y followed by the y edges of row y + 1 for every row
+// every row of edges is stored as row_words 64 bit words, laid out exactly as a row of the same plane of GridGraph, so a file can be mapped or read straight into a GridGraph
+// every node of a generated maze is part of the maze, so nodes are not stored
+
+#define MAZE_FILE_VERSION 1
+
+struct MazeFileHeader{
+    char magic[4]; // "MRMZ"
+    uint32_t version; // MAZE_FILE_VERSION
+    int32_t x_size;
+    int32_t y_size;
+};
+
+typedef std::function<bool(int, const std::vector<uint64_t>&, const std::vector<uint64_t>&)> MazeRowFunction; // receives row y, its x edges and the y edges along its southern side once the row is final
+                                                                                                              // returns false to stop generating
+
+class MazeGenerator{ // abstract base class for algorithms carving a random perfect maze into a GridGraph
+                     // a generator gives the same maze every time for a given seed and size
+    public:
+        virtual ~MazeGenerator(){}
+
+        virtual void generate(GridGraph* Map, unsigned int seed) = 0; // Map must be allocated with every wall set and every node 0, every node is set to 1 once carved
+};
+
+class AldousBroderGenerator: public MazeGenerator{ // walks randomly, removing the wall to every cell visited for the first time
+    public:
+        void generate(GridGraph* Map, unsigned int seed);
+};
+
+class WilsonGenerator: public MazeGenerator{ // walks randomly from each cell not yet in the maze until the maze is reached, then carves the walk with its loops erased
+                                             // the last direction taken out of each cell is all that is remembered of a walk, which erases loops as the walk goes
+    public:
+        void generate(GridGraph* Map, unsigned int seed);
+
+    private:
+        std::vector<uint8_t> walk_directions; // direction each cell of current walk was last left in
+};
+
+class BacktrackerGenerator: public MazeGenerator{ // carves into a random unvisited neighbour, backing up along the carved path whenever a cell has none
+    public:
+        void generate(GridGraph* Map, unsigned int seed);
+
+    private:
+        std::vector<int> path; // cells of carved path back to the first cell, as indexes
+};
+
+class EllerGenerator: public MazeGenerator{ // carves one row at a time, tracking which cells of the current row are already connected through earlier rows
+                                            // only the sets of the current row are held, so memory used depends on width of maze and not its height
+    public:
+        void generate(GridGraph* Map, unsigned int seed);
+        bool generateRows(int x_size, int y_size, unsigned int seed, const MazeRowFunction& writeRow); // passes each row to writeRow as soon as it is final, false if writeRow stopped generation
+
+    private:
+        int findSet(int set); // root of a set of the current row
+
+        std::vector<int> cell_sets; // set of each cell in current row
+        std::vector<int> set_parents; // union-find forest of sets of current row, sets are relabelled each row so there are never more than x_size
+        std::vector<int> set_labels; // new label of each set when relabelling
+        std::vector<int> set_sizes; // number of cells in each set, used to pick a random cell of each set
+        std::vector<int> set_picks; // cells of each set left before the cell which is always carved south, so no set is cut off from later rows
+};
+
+MazeGenerator* createMazeGenerator(int generator_type); // allocates a generator of a specified type, NULL if type is unknown
+
+bool writeMazeFile(std::string file_name, const GridGraph* Map); // false if file could not be written
+bool readMazeFile(std::string file_name, GridGraph* Map); // replaces Map with maze held in file, Map is unchanged if file could not be read or is not a maze file
+bool generateMazeFile(std::string file_name, int x_size, int y_size, unsigned int seed, int generator_type); // mg_Eller streams rows to file as they are generated, other generators build the maze in memory first
+                                                                                                             // false if file could not be written or generator type is unknown
+
+#endif
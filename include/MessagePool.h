@@ -0,0 +1,42 @@
+#ifndef MESSAGEPOOL_H
+#define MESSAGEPOOL_H
+
+#include <cstddef>
+#include <memory>
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// Message Pool
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+// messages are held in place by channel slots and their paths and maps by the payloads of each channel
+// channels of destroyed handlers are pooled and given to the next handler, so payloads keep their memory from one simulation to the next
+// memory is only requested from the system when a channel is allocated or a payload must grow, both of which are counted
+
+void countMessageSystemAllocation(); // adds one to number of blocks requested from the system for messages
+unsigned long getMessageSystemAllocations(); // number of blocks which have been requested from the system for messages
+
+template<class T> struct MessageAllocator{ // allocator of vectors held by payloads, counts every block requested from the system
+    typedef T value_type;
+
+    MessageAllocator(){
+
+    }
+
+    template<class U> MessageAllocator(const MessageAllocator<U>&){ // converting between element types, allocator holds no state
+
+    }
+
+    T* allocate(std::size_t n){
+        countMessageSystemAllocation();
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* block, std::size_t n){
+        std::allocator<T>().deallocate(block, n);
+    }
+
+    template<class U> bool operator==(const MessageAllocator<U>&) const { return true; } // memory from any MessageAllocator can be freed by any other
+    template<class U> bool operator!=(const MessageAllocator<U>&) const { return false; }
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef PATHPLANNER_H
+#define PATHPLANNER_H
+
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <cstdlib>
+
+#include "Coordinates.h"
+#include "PathfindingWorkspace.h"
+
+// point to point planner types
+#define pp_BFS 0 // uninformed breadth first search
+#define pp_AStar 1 // A* search using manhattan distance heuristic
+
+typedef std::function<std::vector<Coordinates>(int, int)> NeighbourFunction; // gathers cells which can be travelled to from a cell
+
+class PathPlanner{ // abstract base class for planners finding a shortest path between two known cells
+                   // planners record parents of searched nodes in a PathfindingWorkspace
+                   // if a path is found, it can be reconstructed by following parents from the destination back to the start
+    public:
+        virtual ~PathPlanner(){}
+
+        virtual bool planPath(PathfindingWorkspace* W, Coordinates start, Coordinates destination, const NeighbourFunction& getNeighbours) = 0; // returns true if destination can be reached from start
+
+        int getNodesExpanded() { return nodes_expanded; } // number of nodes expanded during last search
+                                                          // used to compare planners
+
+    protected:
+        int nodes_expanded;
+};
+
+class BFSPlanner: public PathPlanner{ // breadth first search planner
+    public:
+        bool planPath(PathfindingWorkspace* W, Coordinates start, Coordinates destination, const NeighbourFunction& getNeighbours);
+};
+
+class AStarPlanner: public PathPlanner{ // A* planner using manhattan distance
+                                        // manhattan distance is admissible and consistent as every move is to a 4-connected neighbour with a cost of 1
+                                        // open set is a binary heap which is reused between searches
+    public:
+        bool planPath(PathfindingWorkspace* W, Coordinates start, Coordinates destination, const NeighbourFunction& getNeighbours);
+
+    private:
+        struct HeapEntry{ // node waiting to be expanded
+            int f; // estimated path length through node (g + h)
+            int h; // estimated distance from node to destination
+            int g; // distance from start when entry was pushed
+            int index; // node index within workspace
+        };
+
+        struct HeapCompare{ // orders heap so lowest f is at the top
+                            // ties are broken using lowest h, which favours nodes closer to the destination and reduces expansions along equal cost paths
+            bool operator()(const HeapEntry& a, const HeapEntry& b) const{
+                return (a.f > b.f || (a.f == b.f && a.h > b.h));
+            }
+        };
+
+        std::vector<HeapEntry> open_set; // binary heap of nodes to expand
+};
+
+PathPlanner* createPathPlanner(int planner_type); // allocates a planner of a specified type
+
+#endif
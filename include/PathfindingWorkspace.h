@@ -0,0 +1,79 @@
+#ifndef PATHFINDINGWORKSPACE_H
+#define PATHFINDINGWORKSPACE_H
+
+#include <vector>
+#include <algorithm>
+
+#include "Coordinates.h"
+
+struct PathfindingWorkspace{ // reusable scratch memory for searches over a map of a given size
+                             // nodes are referred to by their row-major index (y * x_size + x)
+                             // a node is only considered visited if its stamp matches the current search generation
+                             // this means the arrays never need to be cleared between searches
+
+    std::vector<int> parent; // parent index of each visited node, start node uses itself as parent
+    std::vector<unsigned int> visited_stamp; // generation of the search which last visited each node
+    std::vector<int> distance; // distance of each visited node from start, only maintained by searches which need it
+    unsigned int generation; // id of the current search
+
+    std::vector<int> node_queue; // FIFO queue of node indexes to be "explored" by a search
+    unsigned int queue_head; // index of front of node_queue
+
+    int x_size; // size of map the workspace was allocated for
+    int y_size;
+
+    PathfindingWorkspace(){ // creating empty workspace
+        generation = 0;
+        queue_head = 0;
+        x_size = 0;
+        y_size = 0;
+    }
+
+    PathfindingWorkspace(int x, int y){ // allocating workspace for a map of size x by y
+        x_size = x;
+        y_size = y;
+
+        parent.assign(x*y, 0);
+        visited_stamp.assign(x*y, 0);
+        distance.assign(x*y, 0);
+        node_queue.reserve(x*y); // a node can only be queued once per search
+
+        generation = 0;
+        queue_head = 0;
+    }
+
+    void beginSearch(){ // invalidates all previously visited nodes and empties queue
+        generation++;
+
+        if(generation == 0){ // generation has wrapped around, stamps from old searches could be mistaken as current
+            std::fill(visited_stamp.begin(), visited_stamp.end(), 0);
+            generation = 1;
+        }
+
+        node_queue.clear();
+        queue_head = 0;
+    }
+
+    // ** Node Index Conversion **
+    int toIndex(int x, int y) const { return y*x_size + x; }
+    int toIndex(Coordinates C) const { return C.y*x_size + C.x; }
+    Coordinates toCoordinates(int i) const { return Coordinates(i % x_size, i / x_size); }
+
+    // ** Visited Node Tracking **
+    bool isVisited(int i) const { return visited_stamp[i] == generation; }
+    int getParent(int i) const { return parent[i]; }
+    void visit(int i, int parent_index){ // marks node as visited during current search with a parent node
+        visited_stamp[i] = generation;
+        parent[i] = parent_index;
+    }
+    int getDistance(int i) const { return distance[i]; }
+    void setDistance(int i, int d){ distance[i] = d; }
+
+    // ** Queue Functions **
+    bool queueEmpty() const { return queue_head >= node_queue.size(); }
+    void push(int i){ node_queue.push_back(i); }
+    int front() const { return node_queue[queue_head]; }
+    void pop(){ queue_head++; }
+};
+
+#endif
@@ -3,11 +3,18 @@
 
 #include <vector>
 #include <queue>
+#include <deque>
+#include <atomic>
 #include <pthread.h>
 
 #include "Coordinates.h"
 #include "Requests.h"
 
+#define MESSAGE_RING_CAPACITY 64 // number of messages a segment of a channel holds, must be a power of 2
+                                 // a full segment is followed by a segment receiver has finished with, or a new one if receiver has fallen behind, so a sender never waits
+#define MESSAGE_PAYLOAD_CAPACITY 8 // number of payloads a channel starts with, a sender rarely has more than one message with a payload waiting
+                                   // sender adds a payload whenever every payload is in use
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~
 // Message Template
 // ~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -20,7 +27,7 @@ enum MessageType{t_Request,t_Response};
 
 struct Message{
     // content of messages and responses, information will be encapsulated using messages defined in RequestTemplates.h
-    m_genericRequest* msg_data; // message data for master to unpack
+    MessageData msg_data; // message data for receiver to unpack, held by value so messages are never allocated
     
     MessageType message_type; // used to determine if sent message is a request or a response within robot
                        // true = message is a response to a previous request
@@ -30,9 +37,24 @@ struct Message{
     int transaction_id; // if message = request, give an expected transaction id to allow sender check for stale response
                         // if message = response, helps original sender determine if request is stale (e.g. robot was forced to change state thus previous request is useless)
 
-    Message(MessageType mess_type, int res_id){
+    int job_epoch; // if message = request, number of targets robot had been given by master when request was sent
+                   // master ignores requests sent before the robot's latest target, 0 for responses
+
+    MessagePayload* Payload; // paths and portions of map sent with message, NULL if message has none
+                             // taken from channel using getPayload, a received payload is valid until the receiver's next getMessage or drainAll
+
+    Message(){ // empty message used to fill channel slots and receive messages into
+        message_type = t_Request;
+        transaction_id = -1;
+        job_epoch = 0;
+        Payload = NULL;
+    }
+
+    Message(MessageType mess_type, int res_id, MessageData data, MessagePayload* payload = NULL, int epoch = 0): msg_data(std::move(data)){
         message_type = mess_type; // assigning message type
         transaction_id = res_id; // assigning response id
+        job_epoch = epoch;
+        Payload = payload;
     }
 };
 
@@ -42,17 +64,91 @@ struct Message{
 
 class RequestHandler{ // class to handle communication between robots and robot master
                       // replace this with bluetooth or equivalent in hardware implementation
+                      // every sender opens its own bounded single producer, single consumer channel so senders never contend with each other
+                      // channels are read by the one thread which receives messages, no operation takes a lock
+                      // messages sent on the same channel are always received in the order they were sent
     public:
-        RequestHandler(); // constructor
+        struct MessageChannel; // channel of one sender, owned by handler
+        struct MessageSegment; // block of MESSAGE_RING_CAPACITY messages held by a channel
+
+        RequestHandler(); // constructor, opens a default channel for a handler with a single sender
         ~RequestHandler(); // destructor
 
-        void sendMessage(Message* m); // add a message address to the message queue
-        Message* getMessage(); // return address of message from front of message queue
-        int getNumberofMessages(); // returns number of requests in msg_queue
+        MessageChannel* openChannel(); // adds a channel for a new sender, channels must be opened before the simulation starts
+                                       // channel is valid until handler is destroyed
+
+        MessagePayload* getPayload(); // empty payload of the default channel, see getPayload(channel)
+        MessagePayload* getPayload(MessageChannel* channel); // empty payload to be filled in place by sender and attached to the next message sent on channel
+                                                             // the same payload is returned until a message carrying it has been sent
+                                                             // never fails, channel gains a payload if receiver still holds every one
+
+        void sendMessage(Message m); // moves message into the default channel
+        void sendMessage(Message m, MessageChannel* channel); // moves message into channel, which must only be sent to by one thread
+                                                              // never fails, channel gains a segment if receiver has not kept up with sender
+        void sendBatch(std::vector<Message>* messages, MessageChannel* channel); // moves every message in order into channel, leaving messages empty
+                                                                                 // receiver is told about the whole batch at once
+        bool getMessage(Message* m); // moves message from front of next channel with a message into m, returns false if there are none
+                                     // channels are visited round-robin so no sender is starved
+                                     // must only be called by one thread
+        int drainAll(std::vector<Message>* messages, unsigned int first_channel = 0); // moves every message sent so far to the back of messages, returns number of messages moved
+                                                                                      // every message of a channel is taken before the next channel, channels are visited in the order they were opened
+                                                                                      // starting from channel first_channel modulo the number of channels, wrapping around to the first channel
+                                                                                      // passing the turn number rotates which sender is handled first, and drains on the same turn always start from the same channel
+                                                                                      // must only be called by the thread which calls getMessage
+        int getNumberofMessages(); // returns number of messages sent but not yet received
 
     private:
-        std::queue<Message*> msg_queue; // FIFO queue of messages sent to RobotMaster Class
-        pthread_mutex_t msg_mutex; // mutex for controlling all operations on msg_queue by threads
+        MessageChannel* nextChannel(MessageChannel* channel); // channel after channel, wrapping around to the first channel
+        void pushMessage(MessageChannel* channel, Message* m); // moves message to back of channel
+        bool popMessage(MessageChannel* channel, Message* m); // moves message from front of channel into m, false if channel is empty
+        void releasePayloads(); // returns payloads of messages received since last getMessage or drainAll to their channels
+
+        MessageChannel* newChannel(); // channel taken from pool of channels freed by destroyed handlers, allocated if pool is empty
+        void freeChannel(MessageChannel* channel); // returns channel to pool so its payloads keep their memory for the next handler
+
+        MessageChannel* default_channel; // first channel, opened by constructor
+        MessageChannel* last_channel; // channel opened most recently, new channels are linked after it
+        MessageChannel* next_channel_to_read; // channel getMessage reads from next
+        unsigned int num_of_channels; // number of channels opened, including default channel
+
+        std::vector<MessageChannel*> channels_holding_payloads; // channels with payloads received since last getMessage or drainAll
+
+        std::atomic<int> num_of_messages; // number of messages sent but not yet received
+};
+
+struct RequestHandler::MessageSegment{ // MESSAGE_RING_CAPACITY slots of a channel, segments of a channel form a list in the order they are filled
+    Message slots[MESSAGE_RING_CAPACITY]; // messages are stored in place
+
+    std::atomic<MessageSegment*> next_segment; // segment receiver moves to once every slot has been read, NULL for last segment, only written by sender
+};
+
+struct RequestHandler::MessageChannel{ // queue of messages, head is only written by the receiver and tail only by the sender
+                                       // messages are held by a list of segments, sender fills the last segment and receiver empties the one it is on
+                                       // segments receiver has moved past are moved to the end of the list by sender, so a channel only allocates when its receiver falls behind
+                                       // payloads are released by the receiver in the order they were sent, sender reuses the most recently released payload first so few payloads ever grow
+    MessageChannel();
+
+    void reset(); // empties channel, segments and payloads keep their memory
+
+    std::deque<MessagePayload> payloads; // paths and portions of map of messages in channel, filled in place by sender
+                                         // only grown by sender, a deque never moves existing payloads so receiver can keep reading them
+
+    // written by receiver
+    alignas(64) std::atomic<unsigned long> head; // position of next message to receive
+    std::atomic<MessageSegment*> head_segment; // segment receiver is taking messages from, every segment before it can be reused by sender
+    std::atomic<unsigned long> payloads_released; // number of payloads receiver has finished with
+    int payloads_held; // number of payloads received but not yet released
+
+    // written by sender
+    alignas(64) std::atomic<unsigned long> tail; // position of next message to send
+    MessageSegment* tail_segment; // last segment of list, sender is filling it
+    MessageSegment* first_segment; // first segment of list, reused by sender once receiver has moved past it
+    unsigned long payloads_sent; // number of payloads sent
+    unsigned long payloads_reclaimed; // number of released payloads which have been returned to free_payloads
+    std::vector<int> sent_payloads; // ring of the index of each payload not yet reclaimed in the order they were sent, one entry per payload
+    std::vector<int> free_payloads; // stack of indexes of payloads which are not in use, most recently released on top
+
+    MessageChannel* next_channel; // channels form a list in the order they were opened, NULL for last channel
 };
 
-#endif
\ No newline at end of file
+#endif
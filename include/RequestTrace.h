@@ -0,0 +1,133 @@
+#ifndef REQUESTTRACE_H
+#define REQUESTTRACE_H
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+
+#include "Coordinates.h"
+#include "Requests.h"
+
+#include "nlohmann/json.hpp" // using json.hpp from https://github.com/nlohmann/json
+
+using json = nlohmann::json; // simplifying namespace so "json" can be used instead of "nlohmann::json" when declaring json objects
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// Request Trace File Layout
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+// a trace is a directory holding three files
+// TRACE_REQUESTS_FILE: TraceHeader followed by one TraceRecord per handled request, in the order requests were handled
+// TRACE_PATHS_FILE: x, y pairs of int32 for every path held by a record, in the same order as the records
+//                   a record's path starts after the paths of every record before it
+// TRACE_INFO_FILE: json holding "Info" and "Maze_Characteristics" of the simulation
+// every value is written in the byte order of the machine, which is little endian on every supported platform
+
+#define TRACE_REQUESTS_FILE "Trace_Requests.bin"
+#define TRACE_PATHS_FILE "Trace_Paths.bin"
+#define TRACE_INFO_FILE "Trace_Info.json"
+
+#define TRACE_VERSION 1
+
+// flags held by TraceRecord
+#define tf_Has_Response 1 // request was responded to, response fields of record are valid
+#define tf_Result 2 // movement occured for move2Cell, cell reserved for reserveCell, target found for getFrontierTarget
+
+// wall bits held by TraceRecord, set if there is a wall
+#define tw_North 1
+#define tw_South 2
+#define tw_East 4
+#define tw_West 8
+
+struct TraceHeader{ // first bytes of TRACE_REQUESTS_FILE
+    char magic[4]; // "MRTR"
+    uint32_t version; // TRACE_VERSION
+    uint32_t record_size; // sizeof(TraceRecord)
+    uint32_t number_of_turns; // number of turns recorded, written once trace is closed
+};
+
+struct TraceRecord{ // fixed layout record of a single request handled by RobotMaster, 36 bytes with no padding
+    uint32_t turn; // turn request was handled on
+    uint32_t transaction; // number of transactions RobotMaster had handled when request was handled
+    uint32_t robot_id; // id of robot sending request, assigned id for addRobot
+    int32_t current_x; // current cell of robot, start position for addRobot
+    int32_t current_y;
+    int32_t target_x; // target cell of move2Cell and getMap
+    int32_t target_y;
+    uint32_t path_length; // number of cells in path of record, planned path of reserveCell request or getFrontierTarget response
+    int8_t type; // request type ID
+    uint8_t walls; // tw_ bits of updateGlobalMap
+    uint8_t flags; // tf_ bits
+    uint8_t unused;
+};
+
+static_assert(sizeof(TraceRecord) == 36, "TraceRecord layout must match trace readers");
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// RequestTrace Class
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+class RequestTrace{ // requests handled during a turn held as TraceRecords
+                    // cleared buffers keep their memory so a trace reused every turn stops allocating once it has held its busiest turn
+    public:
+        // ** RequestTrace Constructors **
+        RequestTrace();
+
+        // ** Record Functions **
+        void addRequest(const MessageData& request, const MessagePayload* request_payload, const MessageData* response, const MessagePayload* response_payload, unsigned int transaction_id); // adds record of request, response can be NULL if no response was sent
+                                                                                                                                                                                         // payloads can be NULL if message has none
+        void addRecord(const TraceRecord& record, const std::vector<Coordinates>* path); // adds a record read from a trace
+        void clear(); // removes every record
+        void swap(RequestTrace* other); // exchanges records with other without copying them
+        void setTurn(unsigned int turn); // sets turn of every record
+
+        bool isEmpty() { return records.empty(); }
+        const std::vector<TraceRecord>& getRecords() { return records; }
+        const std::vector<int32_t>& getPaths() { return paths; } // x, y pairs of every record's path, in record order
+
+        // ** Conversion Functions **
+        json toJSON(); // array of transactions in the format exported by Simulation.json
+
+    private:
+        void addPath(const MessageVector<Coordinates>& path, TraceRecord* record); // appends path to paths and sets path_length of record
+
+        std::vector<TraceRecord> records;
+        std::vector<int32_t> paths;
+};
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// RequestTraceReader Class
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+class RequestTraceReader{ // reads a trace written by TraceWriter one record at a time
+    public:
+        // ** RequestTraceReader Constructors **
+        RequestTraceReader(std::string trace_directory); // trace_directory must end in '/'
+
+        // ** Read Functions **
+        bool isOpen() { return trace_open; } // false if trace is missing or was written by an incompatible version
+        json getInfo() { return info; } // contents of TRACE_INFO_FILE, null if it has not been written
+        bool readRecord(TraceRecord* record, std::vector<Coordinates>* path); // reads next record and its path, false once every record has been read
+        void readTurn(unsigned int turn, RequestTrace* turn_trace); // replaces contents of turn_trace with records handled on turn, turns must be read in increasing order
+        unsigned int getNumberofTurns() { return number_of_turns; }
+
+    private:
+        std::ifstream requests_stream;
+        std::ifstream paths_stream;
+        bool trace_open;
+
+        unsigned int number_of_turns;
+        json info;
+
+        TraceRecord next_record; // record read ahead by readTurn
+        std::vector<Coordinates> next_path;
+        bool has_next_record;
+};
+
+bool convertTraceToJSON(std::string trace_directory, std::string json_file); // writes Simulation.json compatible json file from a trace, reading one turn at a time
+                                                                             // output is identical to exporting the whole simulation as a single json with an indent of 4
+
+#endif
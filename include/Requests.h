@@ -1,6 +1,13 @@
 #ifndef Messages_H
 #define Messages_H
 
+#include <vector>
+#include <deque>
+#include <variant>
+
+#include "Coordinates.h"
+#include "MessagePool.h"
+
 struct RequestHandler; // forward declaration of RequestHandler Class
                        // see RequestHandler.h for definition
 
@@ -12,14 +19,13 @@ struct RequestHandler; // forward declaration of RequestHandler Class
 // when sending a message, set request type to a value specified by the various macros above
 
 struct m_genericRequest{ // template structure used by all requests
-    const int request_type; // defines type of request sent
-                            // uses previously defined IDs
+    int request_type; // defines type of request sent
+                      // uses previously defined IDs
+                      // not const so messages can be moved in and out of channel slots
                             
-    m_genericRequest(int req_type): request_type(req_type){ // assigning request type to const int 
+    m_genericRequest(int req_type): request_type(req_type){ // assigning request type
 
     }
-
-    virtual ~m_genericRequest(){} // creating virtual destructor to ensure that child class destructor is called during "delete" operation
 };
 
 // ~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -38,6 +44,7 @@ struct m_genericRequest{ // template structure used by all requests
 #define reserveCellRequest_ID 3
 #define updateRobotLocationRequest_ID 4
 #define getMapRequest_ID 6
+#define getFrontierTargetRequest_ID 8
 
 // IDs used for Robot -> Master Requests
 #define updateRobotStateRequest_ID 5
@@ -94,9 +101,9 @@ struct m_addRobotResponse:m_genericRequest{ // response containing robot's assig
 // ** updateGlobalMapRequest **
 struct m_updateGlobalMapRequest:m_genericRequest{
     unsigned int robot_id; // id of robot sending request
-    std::vector<bool> wall_info; // content: vector containing information on walls surrounding robot
-                                 // [0] = north, [1] = south, [2] = east, [3] = west
-                                 // 0 = connection, 1 = wall
+    bool wall_info[4]; // content: information on walls surrounding robot
+                       // [0] = north, [1] = south, [2] = east, [3] = west
+                       // 0 = connection, 1 = wall
 
     Coordinates cords; // current coordinates of where the read occured
 
@@ -107,40 +114,25 @@ struct m_updateGlobalMapRequest:m_genericRequest{
 };
 
 // ** reserveCellRequest **
-struct m_reserveCellRequest:m_genericRequest{
+struct m_reserveCellRequest:m_genericRequest{ // planned path to target cell is sent as path of message's payload
     unsigned int robot_id; // id of robot sending request
     
     //Coordinates target_cell; // coordinates correspoonding to full map down a node path if path has been explored already
     Coordinates neighbouring_cell; // neighbouring cell used to enter target cell 
                                    // used to determine which part of maze must be sent back in event node has already been explored
-    
-   std::deque<Coordinates> planned_path;
 
     // Constructor
     m_reserveCellRequest():m_genericRequest(reserveCellRequest_ID){ // assigning request id to request message
         
     }  
 };
-struct m_reserveCellResponse:m_genericRequest{
+struct m_reserveCellResponse:m_genericRequest{ // if cell was not reserved because it has been explored, a portion of GlobalMap is sent as map of message's payload
     bool cell_reserved; // bool determining whether cell was successfully reserved
     Coordinates target_cell; // cell which reserve attempt occured on
-    
-    // returned portion of global map
-    // this is only used if the cell was not reserved
-    std::vector<Coordinates>* map_coordinates; // coordinates correspoonding to full map down the requested node path
-    std::vector<std::vector<bool>>* map_connections; // wall information corresponding to nodes in map_coordinates
-    std::vector<char>* map_status; // node status information of nodes in map_coordinates
-
-    m_reserveCellResponse():m_genericRequest(reserveCellRequest_ID){ // allocating various vectors
-        map_coordinates = new std::vector<Coordinates>;
-        map_connections = new std::vector<std::vector<bool>>;
-        map_status = new std::vector<char>;
-    }
-    
-    ~m_reserveCellResponse(){ // deallocating various vectors
-        delete map_connections;
-        delete map_coordinates;
-        delete map_status;
+
+    // Constructor
+    m_reserveCellResponse():m_genericRequest(reserveCellRequest_ID){ // assigning request id to request message
+
     }
 };
 
@@ -185,12 +177,7 @@ struct m_getMapRequest:m_genericRequest{
         
     }  
 };
-struct m_getMapResponse:m_genericRequest{
-
-    // GlobalMap information from robot's position to target cell
-    std::vector<Coordinates> map_coordinates; // coordinates correspoonding to full map down the requested node path
-    std::vector<std::vector<bool>> map_connections; // wall information corresponding to nodes in map_coordinates
-    std::vector<char> map_status; // node status information of nodes in map_coordinates
+struct m_getMapResponse:m_genericRequest{ // GlobalMap information from robot's position to target cell is sent as map of message's payload
 
     // Constructor
     m_getMapResponse():m_genericRequest(getMapRequest_ID){ // assigning request id to request message
@@ -198,6 +185,26 @@ struct m_getMapResponse:m_genericRequest{
     }  
 };
 
+// ** getFrontierTargetRequest **
+struct m_getFrontierTargetRequest:m_genericRequest{ // request for master to find and reserve the closest unreserved frontier cell to the robot
+    unsigned int robot_id; // id of robot sending request
+    Coordinates current_cell; // current cell of robot
+
+    // Constructor
+    m_getFrontierTargetRequest():m_genericRequest(getFrontierTargetRequest_ID){ // assigning request id to request message
+        
+    }  
+};
+struct m_getFrontierTargetResponse:m_genericRequest{ // path to reserved frontier cell is sent as path of message's payload
+                                                    // GlobalMap information of robot's current cell and every cell of path is sent as map of message's payload
+    bool target_found; // bool determining whether a frontier cell was found and reserved for the robot
+
+    // Constructor
+    m_getFrontierTargetResponse():m_genericRequest(getFrontierTargetRequest_ID){ // assigning request id to request message
+        
+    }  
+};
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~
 // Master -> Robot Messages 
 // ~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -214,10 +221,63 @@ struct m_updateRobotStateRequest:m_genericRequest{
 // ** setTargetCellRequest **
 struct m_setTargetCellRequest:m_genericRequest{
     Coordinates new_target_cell;
+    int job_epoch; // number of targets master has given robot including this one, robot sends it with every following request
+                   // master ignores requests carrying an older epoch as they were sent before robot received this target
 
     m_setTargetCellRequest():m_genericRequest(setTargetCell_ID){ // assigning request id to request message
         
     }  
 };
 
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// Message Data
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+// every request and response which can be sent, held by value inside a Message so no message is allocated
+// a request and its response share a request_type, the held alternative tells them apart
+typedef std::variant<m_shutDownRequest, m_shutDownResponse,
+                     m_addRobotRequest, m_addRobotResponse,
+                     m_updateGlobalMapRequest,
+                     m_reserveCellRequest, m_reserveCellResponse,
+                     m_updateRobotLocationRequest,
+                     m_move2CellRequest, m_move2CellResponse,
+                     m_getMapRequest, m_getMapResponse,
+                     m_getFrontierTargetRequest, m_getFrontierTargetResponse,
+                     m_updateRobotStateRequest,
+                     m_setTargetCellRequest> MessageData;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// Message Payload
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+// paths and portions of map vary in size so they are held outside of MessageData, keeping every message small
+// payloads belong to the channel a message is sent on, sender fills one in place and receiver reads it in place (see RequestHandler.h)
+// vectors keep their memory as payloads are reused, so once a channel's payloads have held its largest path and map no message needs to allocate
+
+template<class T> using MessageVector = std::vector<T, MessageAllocator<T>>; // vector held by a payload, growth is counted by getMessageSystemAllocations
+
+struct MessagePayload{
+    MessageVector<Coordinates> path; // planned path of reserveCell request or getFrontierTarget response
+    
+    // portion of map sent by reserveCell, getMap and getFrontierTarget responses
+    MessageVector<Coordinates> map_coordinates; // coordinates of nodes in portion of map
+    MessageVector<char> map_walls; // 4 walls of each node in map_coordinates, [0] = north, [1] = south, [2] = east, [3] = west
+                                   // 0 = connection, 1 = wall
+    MessageVector<char> map_status; // node status of each node in map_coordinates
+
+    void clear(){ // empties payload while keeping its memory
+        path.clear();
+        map_coordinates.clear();
+        map_walls.clear();
+        map_status.clear();
+    }
+};
+
+template<class... Handlers> struct MessageVisitor: Handlers... { using Handlers::operator()...; }; // combines a handler for each message type into one visitor for std::visit
+template<class... Handlers> MessageVisitor(Handlers...) -> MessageVisitor<Handlers...>;
+
+inline int getRequestType(const MessageData& data){ // request type ID of held message
+    return std::visit([](const m_genericRequest& request){ return request.request_type; }, data);
+}
+
 #endif
\ No newline at end of file
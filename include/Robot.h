@@ -9,9 +9,20 @@
 #include <string>
 #include <stdexcept>
 #include <algorithm>
+#include <random>
 
 #include "GridGraph.h"
 #include "Coordinates.h"
+#include "PathfindingWorkspace.h"
+#include "PathPlanner.h"
+
+// nearest unknown cell search modes
+#define fs_BFS 0 // full breadth first search from robot's position on every call
+#define fs_IncrementalBFS 1 // resumes previous breadth first search if robot has not moved and map changes did not touch searched cells
+#define fs_MasterField 2 // closest unreserved unexplored cell is requested from RobotMaster's frontier distance field (cell reservation robots only)
+                         // LocalMap is only searched if RobotMaster cannot find a cell, using the same search as fs_BFS
+                         // reserved cells are never offered, so greedy robots cannot take a cell they are closer to and exploration takes more turns than fs_IncrementalBFS
+                         // each reservation or explored frontier cell makes RobotMaster repair every cell that was closest to it, so it is also slower per turn
 
 class Robot{ // parent class used as a template for further robot implementations
              // contains all basic robot functions (movement, scanning, etc.)
@@ -40,6 +51,11 @@ class Robot{ // parent class used as a template for further robot implementation
 
         void setLocalMap(GridGraph* new_map); // passes contents of map in robot's LocalMap
 
+        void setFrontierSearchMode(int mode); // selects algorithm used by BFS_pf2NearestUnknownCell (fs_BFS, fs_IncrementalBFS or fs_MasterField)
+        void setPathPlanner(int planner_type); // selects algorithm used by pf_2Target (pp_BFS or pp_AStar)
+        int getRobotStatus() { return robot_status; } // gets status robot will compute on its next loop step
+        void setRandomSeed(unsigned int seed) { tie_breaker.seed(seed); } // seeds generator used to break ties between equally close cells so simulations can be repeated
+
     protected:
         // protected functions:
 
@@ -49,13 +65,17 @@ class Robot{ // parent class used as a template for further robot implementation
         bool move2Cell(Coordinates destination); // moves robot to neighbouring cell using neighbouring cell coordinates
 
         // ** Path-Finding Functions **
-        bool pf_BFS(int x, int y); // modifies planned path with the fastest path to a specified location
+        bool pf_2Target(int x, int y); // modifies planned path with the fastest path to a specified location using robot's path planner
         bool BFS_pf2NearestUnknownCell(std::deque<Coordinates>* ret_vector); // modifies planned path with fastest path to the closest unknown cell on robot's local map
         virtual void BFS_noPathFound(); // function which handles if a path is not found
         virtual bool BFS_exitCondition(Coordinates* node_to_test); // function used to determine exit condition from BFS_pf2NearestUnknownCell
 
         std::vector<Coordinates> getValidNeighbours(int x, int y); // gathers valid neighbours of a cell
                                                                    // used in pathfinding functions
+
+        void resetFrontierSearch(); // discards saved nearest unknown cell search so next search starts from scratch
+                                    // must be called if BFS_exitCondition can become true for a cell it previously rejected
+        void localMapCellChanged(int x, int y); // notifies saved nearest unknown cell search that a cell or its walls have changed on LocalMap
         
         //protected data members:
         
@@ -68,8 +88,19 @@ class Robot{ // parent class used as a template for further robot implementation
         
         GridGraph* LocalMap; // local_map maintained by robot of areas explored
 
+        PathfindingWorkspace Workspace; // parent array and queue reused by every search on LocalMap
+        PathPlanner* Planner; // planner used to find paths to known target cells
+
+        int frontier_search_mode; // algorithm used when searching for nearest unknown cell
+        PathfindingWorkspace FrontierSearch; // state of last nearest unknown cell search
+                                             // kept seperate from Workspace so it can be resumed after other searches
+        bool frontier_search_valid; // whether FrontierSearch can be resumed
+        Coordinates frontier_search_source; // position of robot when FrontierSearch was started
+
         int robot_status; // tracks status of robot within the robot loop
 
+        std::minstd_rand tie_breaker; // small random number generator used to remove bias between equally close cells, owned by robot so runs never depend on thread timing
+
     private:
         unsigned int maze_xsize; // size of maze
         unsigned int maze_ysize; // this is not used by exploration algorithms
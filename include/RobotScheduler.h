@@ -0,0 +1,96 @@
+#ifndef ROBOTSCHEDULER_H
+#define ROBOTSCHEDULER_H
+
+#include <vector>
+#include <queue>
+#include <coroutine>
+#include <exception>
+
+#include "MultiRobot.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// RobotBehaviour Coroutine
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+class RobotBehaviour{ // coroutine running the behaviour of a single robot, suspends itself by awaiting RobotScheduler::waitTurns or RobotScheduler::waitForMaster
+                      // behaviour does not start until it is given to RobotScheduler::spawn, which then owns it
+    public:
+        struct promise_type{
+            RobotBehaviour get_return_object() { return RobotBehaviour(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; } // scheduler decides when behaviour first runs
+            std::suspend_always final_suspend() noexcept { return {}; } // scheduler destroys finished behaviours
+            void return_void() {}
+            void unhandled_exception() { throw; } // errors are passed on to whoever resumed the behaviour
+        };
+
+        RobotBehaviour(RobotBehaviour&& other): handle(other.handle) { other.handle = {}; }
+        RobotBehaviour(const RobotBehaviour&) = delete;
+        ~RobotBehaviour(); // destroys behaviour if it was never given to a scheduler
+
+        std::coroutine_handle<> release(); // gives up ownership of behaviour
+
+    private:
+        RobotBehaviour(std::coroutine_handle<promise_type> h): handle(h) {}
+
+        std::coroutine_handle<promise_type> handle;
+};
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// RobotScheduler Class
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+
+class RobotScheduler{ // runs any number of robot behaviours on the calling thread, each behaviour only holds its coroutine frame instead of a thread stack
+                      // a behaviour is resumed once the turns it awaits have elapsed or once RobotMaster has sent its robot a message
+                      // behaviours resumed on the same turn are always resumed in the order they were spawned so every run is identical
+    public:
+        // ** RobotScheduler Constructors **
+        RobotScheduler();
+        ~RobotScheduler(); // destroys every behaviour which has not finished
+
+        // ** Behaviour Functions **
+        int spawn(RobotBehaviour behaviour); // takes ownership of behaviour and runs it until it first suspends, returns index behaviour is ordered by
+        void runTurn(unsigned int turn); // resumes every behaviour waiting for turn, turns must be run in increasing order
+        void wakeMessageWaiters(); // schedules behaviours waiting for RobotMaster whose robot has been sent a message, must be called once RobotMaster has handled requests of last run turn
+
+        bool hasScheduledTurns() { return !wake_up_events.empty(); } // false if every unfinished behaviour is waiting for RobotMaster
+        unsigned int getNextTurn() { return wake_up_events.top().first; } // earliest turn a behaviour is waiting for, only valid if hasScheduledTurns()
+        int getNumberofBehaviours() { return num_of_running_behaviours; } // number of behaviours which have not finished
+
+        // ** Awaitables **
+        struct TurnDelay{ // awaitable which resumes behaviour once a number of turns have elapsed
+            RobotScheduler* scheduler;
+            unsigned int turns;
+
+            bool await_ready() { return false; }
+            void await_suspend(std::coroutine_handle<>) { scheduler->scheduleCurrent(scheduler->current_turn + turns); }
+            void await_resume() {}
+        };
+
+        struct MasterWait{ // awaitable which resumes behaviour on the turn after RobotMaster has sent robot a message
+            RobotScheduler* scheduler;
+            MultiRobot* robot;
+
+            bool await_ready() { return false; }
+            void await_suspend(std::coroutine_handle<>) { scheduler->waitCurrentForMaster(robot); }
+            void await_resume() {}
+        };
+
+        TurnDelay waitTurns(unsigned int turns) { return TurnDelay{this, turns}; } // turns must be at least 1
+        MasterWait waitForMaster(MultiRobot* robot) { return MasterWait{this, robot}; }
+
+    private:
+        void resume(int behaviour); // resumes behaviour, destroying it if it finishes
+        void scheduleCurrent(unsigned int turn); // schedules behaviour being resumed to be resumed again on turn
+        void waitCurrentForMaster(MultiRobot* robot); // parks behaviour being resumed until robot is sent a message
+
+        std::vector<std::coroutine_handle<>> behaviours; // every spawned behaviour by index, NULL once finished
+        int num_of_running_behaviours;
+
+        std::priority_queue<std::pair<unsigned int, int>, std::vector<std::pair<unsigned int, int>>, std::greater<std::pair<unsigned int, int>>> wake_up_events; // (turn, behaviour index) pairs ordered by turn then index
+        std::vector<std::pair<int, MultiRobot*>> message_waiters; // behaviours waiting for RobotMaster and the robot they are waiting on
+
+        unsigned int current_turn; // last turn run, 0 before first turn
+        int current_behaviour; // behaviour being resumed, -1 if none
+};
+
+#endif
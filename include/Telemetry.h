@@ -0,0 +1,18 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+// telemetry levels, each level records everything recorded by the levels below it
+#define tl_Off 0 // nothing is recorded, a simulation only does exploration work
+#define tl_Summary 1 // number of turns taken, number of robots and maze size are exported to Simulation.json
+#define tl_Turn 2 // GlobalMap and robot positions are recorded every turn if printouts are enabled
+#define tl_Request 3 // every request handled by RobotMaster is traced
+
+template<int telemetry_level> struct Telemetry{ // policy selecting what a simulation records, passed as a template parameter to simulation loops
+                                                // every check is a compile time constant so code of disabled levels is never generated
+    static constexpr int level = telemetry_level;
+    static constexpr bool summary = telemetry_level >= tl_Summary;
+    static constexpr bool turns = telemetry_level >= tl_Turn;
+    static constexpr bool requests = telemetry_level >= tl_Request;
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef TRACEWRITER_H
+#define TRACEWRITER_H
+
+#include <string>
+#include <deque>
+#include <vector>
+#include <fstream>
+#include <cstddef>
+#include <pthread.h>
+
+#include "RequestTrace.h"
+
+#define TRACE_QUEUE_CAPACITY 256 // number of turns which can wait to be written before writeTurn blocks
+                                 // bounds memory used by a trace if turns are added faster than they can be written
+
+class TraceWriter{ // streams requests handled each turn to a binary trace as they are produced, see RequestTrace.h for the layout of a trace
+                   // turns are written by a background thread so the simulation never waits on the disk
+                   // turn buffers are swapped rather than copied and are reused once written, so a trace stops allocating once the queue has warmed up
+    public:
+        // ** TraceWriter Constructors **
+        TraceWriter(std::string trace_directory); // creates trace in trace_directory, which must end in '/', overwriting any existing trace
+        ~TraceWriter(); // closes trace if close has not been called
+
+        // ** Trace Functions **
+        bool isOpen() { return trace_open; } // false if trace files could not be created
+        void writeTurn(unsigned int turn, RequestTrace* turn_trace); // moves records of turn_trace to back of write queue leaving turn_trace empty, waits if queue is full
+                                                                     // turns must be written in increasing order starting from turn 1
+        void writeInfo(json info); // information on whole simulation, written once trace is closed
+        void close(); // writes every queued turn then closes trace
+
+    private:
+        static void* writerFunc(void* Writer_Info); // loop run by background thread writing queued turns
+
+        std::string trace_directory;
+        std::ofstream requests_stream;
+        std::ofstream paths_stream;
+        bool trace_open;
+
+        json info;
+        unsigned int number_of_turns; // turns written so far, only used by writer thread until trace is closed
+
+        std::deque<RequestTrace*> turn_queue; // turns waiting to be written
+        std::vector<RequestTrace*> free_traces; // written turn buffers waiting to be reused
+        int number_of_traces; // turn buffers allocated, never more than TRACE_QUEUE_CAPACITY
+        bool closing; // set once no more turns will be added
+
+        pthread_t writer_thread;
+        pthread_mutex_t queue_lock; // protects turn_queue, free_traces and closing
+        pthread_cond_t turn_added; // signals writer a turn has been queued or trace is closing
+        pthread_cond_t turn_written; // signals writeTurn a turn buffer has been freed
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef TREEDISTANCEORACLE_H
+#define TREEDISTANCEORACLE_H
+
+#include <vector>
+#include <deque>
+#include <queue>
+
+#include "Coordinates.h"
+
+class TreeDistanceOracle{ // answers distance and path queries between known cells of a map whose connections form a forest
+                          // in a perfect maze the path between two cells is unique so its length is fixed by their lowest common ancestor
+                          // each cell stores its parent, depth and a skew-binary jump pointer, giving O(log n) ancestor queries
+                          // cells can be attached in O(1), trees are joined by re-rooting the smaller tree
+                          // once a connection closes a cycle the oracle stops answering queries and callers must fall back to a search
+    public:
+        // ** TreeDistanceOracle Constructors **
+        TreeDistanceOracle(int x, int y); // allocating oracle for a map of size x by y
+
+        // ** Maintenance Functions **
+        void addCell(Coordinates C); // adds a known cell with no connections
+        void addConnection(Coordinates a, Coordinates b); // adds an open connection between two neighbouring cells, unknown cells are added first
+
+        // ** Query Functions **
+        bool isTree() { return is_tree; } // false once a cycle has been found
+        bool isKnown(Coordinates C) { return component[toIndex(C)] >= 0; }
+        int getDistance(Coordinates a, Coordinates b); // length of path between cells, -1 if they are not connected or oracle is no longer valid
+        bool getPath(Coordinates a, Coordinates b, std::deque<Coordinates>* path); // path contains every cell after a up to and including b
+
+    private:
+        int toIndex(Coordinates C) { return C.y*x_size + C.x; }
+        Coordinates toCoordinates(int i) { return Coordinates(i % x_size, i / x_size); }
+        int linkDirection(int a, int b); // direction of b from a (0 = north, 1 = south, 2 = east, 3 = west)
+        int neighbourIndex(int i, int dir);
+
+        void setParent(int i, int p); // attaches cell below parent and computes its jump pointer
+        void setRoot(int i);
+        int ancestorAtDepth(int i, int d); // ancestor of cell at depth d
+        int getLCA(int a, int b); // lowest common ancestor of two cells in the same tree
+
+        int x_size;
+        int y_size;
+
+        bool is_tree;
+
+        std::vector<int> parent; // parent of each cell, roots are their own parent
+        std::vector<int> jump; // skew-binary jump pointer of each cell
+        std::vector<int> depth; // depth of each cell in its tree
+        std::vector<int> component; // tree each cell belongs to (id of its first cell), -1 if unknown
+        std::vector<int> component_size; // number of cells in tree of each id
+        std::vector<char> links; // bit mask of connections of each cell, bit = direction
+};
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef TURNEXECUTOR_H
+#define TURNEXECUTOR_H
+
+#include <vector>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <exception>
+#include <pthread.h>
+
+class TurnExecutor{ // fixed size pool of worker threads which runs every task of a turn phase in parallel
+                    // tasks of a phase are split evenly between workers, a worker which runs out of tasks steals half of the remaining tasks of another worker
+                    // calling thread takes part as a worker, so runPhase only returns once every task of the phase has completed
+                    // runPhase must only be called by the thread which created the executor
+                    // a task which throws does not stop the phase, first exception thrown is rethrown by runPhase once every task has completed
+    public:
+        // ** TurnExecutor Constructors **
+        TurnExecutor(int num_of_threads); // num_of_threads includes calling thread, 0 uses one thread per hardware thread
+        ~TurnExecutor();
+
+        // ** Phase Functions **
+        void runPhase(int num_of_tasks, const std::function<void(int)>& task); // runs task(i) for every i in [0, num_of_tasks), each task runs exactly once
+                                                                                // rethrows first exception thrown by a task of the phase
+        int getNumberofThreads() { return num_of_workers; } // number of threads tasks are run on, including calling thread
+
+    private:
+        struct TaskRange{ // tasks still owned by a worker
+            alignas(64) std::atomic<unsigned long> range; // first task in upper 32 bits, one past last task in lower 32 bits
+                                                          // packed so owner and thieves can both change it with a single compare and swap
+        };
+
+        struct WorkerArgs{ // structure to hold args for passing worker information into a new thread
+            TurnExecutor* executor;
+            int worker;
+        };
+
+        static void* workerFunc(void* Worker_Info); // loop run by every worker thread other than calling thread
+        void runTasks(int worker); // runs tasks owned by worker, then steals tasks until none remain
+                                   // exceptions thrown by tasks are caught so every worker reaches phase_end_barrier
+        bool takeTask(int worker, int* task); // takes first task owned by worker, false if worker owns none
+        bool stealTasks(int thief); // moves half of the tasks of another worker to thief, false if no worker has any tasks left
+
+        static unsigned long packRange(unsigned long first, unsigned long last) { return (first << 32) | last; }
+
+        int num_of_workers;
+
+        std::vector<TaskRange> task_ranges; // tasks owned by each worker, worker 0 is calling thread
+        std::vector<pthread_t> worker_threads; // threads of workers 1 to num_of_workers - 1
+        std::vector<WorkerArgs> worker_args;
+
+        pthread_barrier_t phase_start_barrier, phase_end_barrier; // barriers to fork workers into a phase and join them at its end
+
+        const std::function<void(int)>* phase_task; // task of current phase, only written before phase_start_barrier
+        bool shutting_down; // tells workers to exit instead of running a phase
+
+        std::exception_ptr phase_exception; // first exception thrown by a task of current phase, NULL if none
+        pthread_mutex_t phase_exception_lock; // lock preventing workers from storing an exception at the same time
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef WAVEFRONTBFS_H
+#define WAVEFRONTBFS_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "GridGraph.h"
+#include "Coordinates.h"
+
+// map types understood by the wavefront
+#define wf_MasterMap 0 // RobotMaster GlobalMap rules: any seen cell (state > 0) can be expanded and entered
+#define wf_FrontierMap 1 // frontier distance field rules: unexplored cells (state 2) added as sources and explored cells (state 1) are expanded, only explored cells can be entered
+
+class WavefrontBFS{ // bit-parallel breadth first search over the packed planes of a GridGraph
+                    // each layer of the search is stored as a bitset with one bit per cell
+                    // a layer is expanded 64 cells at a time by shifting it in all four directions and masking out walls and visited cells
+                    // rows are processed using AVX2 when compiled with it, otherwise a scalar kernel is used
+                    // only rows holding cells of the current layer are expanded, and only rows reached by a search are cleared before the next one
+    public:
+        // ** WavefrontBFS Constructors **
+        WavefrontBFS();
+        WavefrontBFS(int x, int y); // allocating wavefront for a map of size x by y
+
+        // ** Search Functions **
+        void beginSearch(const GridGraph* map, int map_type); // loads cell masks from map and clears previous search
+                                                              // map must not be modified until search is finished
+        void addSource(Coordinates source); // adds a cell to layer 0 of the search
+        bool expandLayer(); // computes the next layer of the search
+                            // returns false if no new cells were reached
+
+        // ** Layer Functions **
+        int getLayerDistance() { return layer_distance; } // distance of current layer from sources
+        bool layerEmpty() { return active_rows.empty(); } // whether current layer contains any cells
+
+        // ** Distance Functions **
+        bool isReached(Coordinates C); // whether cell has been reached by search
+        int getDistance(Coordinates C); // distance of reached cell from its nearest source
+        void computeDistanceField(const GridGraph* map, int map_type, std::vector<Coordinates>* sources, std::vector<int>* distances); // runs search until exhausted and stores distance of every cell
+                                                                                                                                      // distances are in row-major order, unreached cells are set to -1
+    private:
+        void expandRow(int y); // computes row y of next layer from current layer
+        void activateRow(int y); // adds row y to rows of current layer, clearing cells left in it by earlier layers
+
+        int x_size; // size of map the wavefront was allocated for
+        int y_size;
+        int row_words; // number of 64 bit words per row (matches GridGraph)
+
+        const GridGraph* Map; // map currently being searched
+
+        std::vector<uint64_t> expandable; // cells which can be expanded from
+        std::vector<uint64_t> enterable; // cells which can be entered
+        std::vector<uint64_t> visited; // cells reached by search
+
+        std::vector<uint64_t> layer; // cells in current layer
+        std::vector<uint64_t> next_layer; // cells in layer being computed
+        std::vector<uint64_t> source_mask; // current layer masked with expandable, used as source of expansion
+
+        std::vector<int> active_rows; // rows containing cells of current layer in ascending order, other rows of layer are never read
+        std::vector<int> next_rows; // rows containing cells of layer being computed
+        std::vector<char> row_active; // whether each row is in active_rows
+
+        int dirty_first; // first and last rows reached since visited was cleared
+        int dirty_last;
+
+        int layer_distance; // distance of current layer from sources
+
+        std::vector<int> distance; // distance of each cell, only valid if cell has been visited
+};
+
+#endif
@@ -0,0 +1,90 @@
+#include "AssignmentSolver.h"
+
+std::vector<int> solveAssignment(const std::vector<std::vector<int>>* cost){ // hungarian algorithm using row and column potentials
+                                                                            // rows are added one at a time, each along a shortest augmenting path of reduced costs
+
+    int rows = cost->size();
+
+    if(rows == 0){
+        return std::vector<int>();
+    }
+
+    int cols = (*cost)[0].size();
+    int padded_cols = (cols < rows) ? rows : cols; // algorithm requires at least as many columns as rows, extra columns can never be assigned
+
+    const long long INF = std::numeric_limits<long long>::max() / 4;
+
+    // arrays are 1 indexed, column 0 is a placeholder used to start each augmenting path
+    std::vector<long long> row_potential(rows + 1, 0);
+    std::vector<long long> col_potential(padded_cols + 1, 0);
+    std::vector<int> col_match(padded_cols + 1, 0); // row matched to each column, 0 if unmatched
+    std::vector<int> previous_col(padded_cols + 1, 0); // column before each column along augmenting path
+
+    std::vector<long long> min_reduced(padded_cols + 1);
+    std::vector<char> used(padded_cols + 1);
+
+    for(int row = 1; row <= rows; row++){
+        col_match[0] = row;
+        int curr_col = 0;
+
+        std::fill(min_reduced.begin(), min_reduced.end(), INF);
+        std::fill(used.begin(), used.end(), 0);
+
+        do{ // growing shortest path tree until an unmatched column is reached
+            used[curr_col] = 1;
+
+            int curr_row = col_match[curr_col];
+            long long delta = INF;
+            int next_col = 0;
+
+            for(int col = 1; col <= padded_cols; col++){
+                if(used[col]){
+                    continue;
+                }
+
+                long long c = (col <= cols) ? (*cost)[curr_row - 1][col - 1] : NO_ASSIGNMENT_COST;
+                long long reduced = c - row_potential[curr_row] - col_potential[col];
+
+                if(reduced < min_reduced[col]){
+                    min_reduced[col] = reduced;
+                    previous_col[col] = curr_col;
+                }
+
+                if(min_reduced[col] < delta){
+                    delta = min_reduced[col];
+                    next_col = col;
+                }
+            }
+
+            for(int col = 0; col <= padded_cols; col++){ // updating potentials so tree edges stay tight
+                if(used[col]){
+                    row_potential[col_match[col]] += delta;
+                    col_potential[col] -= delta;
+                }
+                else{
+                    min_reduced[col] -= delta;
+                }
+            }
+
+            curr_col = next_col;
+        } while(col_match[curr_col] != 0);
+
+        do{ // flipping matches along augmenting path
+            int prev = previous_col[curr_col];
+            col_match[curr_col] = col_match[prev];
+            curr_col = prev;
+        } while(curr_col != 0);
+    }
+
+    std::vector<int> assignment(rows, -1);
+
+    for(int col = 1; col <= cols; col++){
+        int row = col_match[col];
+
+        if(row != 0 && (*cost)[row - 1][col - 1] < NO_ASSIGNMENT_COST){ // pairs which cannot be assigned are left unassigned
+            assignment[row - 1] = col - 1;
+        }
+    }
+
+    return assignment;
+}
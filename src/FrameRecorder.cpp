@@ -0,0 +1,380 @@
+#include "FrameRecorder.h"
+
+#include <sstream>
+#include <filesystem>
+#include <fmt/format.h>
+
+// ** FrameRecorder Constructors **
+
+FrameRecorder::FrameRecorder(std::string directory, int x_size, int y_size): frame_stream(directory + FRAMES_FILE, std::ios::binary), last_map(x_size, y_size){
+
+    frames_open = frame_stream.is_open();
+    changes_since_keyframe = 0;
+    last_keyframe = 0;
+
+    if(frames_open){
+        FrameHeader header = { {'M', 'R', 'F', 'R'}, FRAME_VERSION, x_size, y_size, 0, 0, 0 }; // number of frames and index are filled in once recorder is closed
+        frame_stream.write((char*)&header, sizeof(FrameHeader));
+    }
+}
+
+FrameRecorder::~FrameRecorder(){
+    close();
+}
+
+// ** Record Functions **
+
+void FrameRecorder::recordFrame(unsigned int turn, const GridGraph* Map, const std::vector<Coordinates>* robot_positions, bool map_changed){
+
+    if(!frames_open){
+        return;
+    }
+
+    FrameIndexEntry entry;
+    entry.offset = frame_stream.tellp();
+    entry.turn = turn;
+
+    if(index.empty() || changes_since_keyframe >= (uint64_t)Map->getXSize()*Map->getYSize()){ // replaying changes from last keyframe would cost more than reading a new keyframe
+        writeKeyframe(Map, robot_positions);
+
+        last_map = *Map;
+        last_keyframe = index.size();
+        changes_since_keyframe = 0;
+    }
+    else{
+        changes.clear();
+
+        if(map_changed){
+            findMapChanges(Map);
+        }
+
+        bool map_differs = !changes.empty();
+
+        findRobotChanges(robot_positions);
+
+        uint32_t number_of_changes = changes.size();
+        frame_stream.write((char*)&number_of_changes, sizeof(uint32_t));
+        frame_stream.write((char*)changes.data(), changes.size()*sizeof(FrameChange));
+
+        if(map_differs){
+            last_map = *Map; // planes are copied a word at a time, far cheaper than rendering the map
+        }
+
+        changes_since_keyframe += number_of_changes;
+    }
+
+    last_positions = *robot_positions;
+
+    entry.keyframe = last_keyframe;
+    index.push_back(entry);
+
+    return;
+}
+
+void FrameRecorder::close(){
+
+    if(!frames_open){
+        return;
+    }
+
+    uint64_t index_offset = frame_stream.tellp();
+    frame_stream.write((char*)index.data(), index.size()*sizeof(FrameIndexEntry));
+
+    uint32_t number_of_frames = index.size();
+
+    frame_stream.seekp(offsetof(FrameHeader, number_of_frames)); // filling in header now that every frame is known
+    frame_stream.write((char*)&number_of_frames, sizeof(uint32_t));
+    frame_stream.seekp(offsetof(FrameHeader, index_offset));
+    frame_stream.write((char*)&index_offset, sizeof(uint64_t));
+
+    frame_stream.close();
+    frames_open = false;
+
+    return;
+}
+
+void FrameRecorder::writeKeyframe(const GridGraph* Map, const std::vector<Coordinates>* robot_positions){
+
+    uint32_t number_of_robots = robot_positions->size();
+    frame_stream.write((char*)&number_of_robots, sizeof(uint32_t));
+
+    for(int i = 0; i < robot_positions->size(); i++){
+        int32_t cell[2] = { (*robot_positions)[i].x, (*robot_positions)[i].y };
+        frame_stream.write((char*)cell, sizeof(cell));
+    }
+
+    int y_size = Map->getYSize();
+    int row_words = Map->getRowWords();
+
+    if(y_size > 0){ // every plane is stored contiguously so whole planes are written at once
+        frame_stream.write((const char*)Map->getNodeLowRow(0), row_words*y_size*sizeof(uint64_t));
+        frame_stream.write((const char*)Map->getNodeHighRow(0), row_words*y_size*sizeof(uint64_t));
+        frame_stream.write((const char*)Map->getXEdgeRow(0), row_words*y_size*sizeof(uint64_t));
+        frame_stream.write((const char*)Map->getYEdgeRow(0), row_words*(y_size + 1)*sizeof(uint64_t));
+    }
+
+    return;
+}
+
+void FrameRecorder::findMapChanges(const GridGraph* Map){
+
+    int y_size = Map->getYSize();
+    int row_words = Map->getRowWords();
+
+    for(int y = 0; y < y_size + 1; y++){
+        for(int w = 0; w < row_words; w++){
+            if(y < y_size){
+                uint64_t node_diff = (Map->getNodeLowRow(y)[w] ^ last_map.getNodeLowRow(y)[w]) | (Map->getNodeHighRow(y)[w] ^ last_map.getNodeHighRow(y)[w]);
+                uint64_t x_edge_diff = Map->getXEdgeRow(y)[w] ^ last_map.getXEdgeRow(y)[w];
+
+                while(node_diff != 0){ // visiting every changed bit of word
+                    int x = w*64 + __builtin_ctzll(node_diff);
+                    changes.push_back({x, y, 0, fc_Node, (uint8_t)Map->getNode(x, y), 0});
+                    node_diff &= node_diff - 1;
+                }
+
+                while(x_edge_diff != 0){
+                    int x = w*64 + __builtin_ctzll(x_edge_diff);
+                    changes.push_back({x, y, 0, fc_XEdge, (uint8_t)Map->getXEdge(x, y), 0});
+                    x_edge_diff &= x_edge_diff - 1;
+                }
+            }
+
+            uint64_t y_edge_diff = Map->getYEdgeRow(y)[w] ^ last_map.getYEdgeRow(y)[w];
+
+            while(y_edge_diff != 0){
+                int x = w*64 + __builtin_ctzll(y_edge_diff);
+                changes.push_back({x, y, 0, fc_YEdge, (uint8_t)Map->getYEdge(x, y), 0});
+                y_edge_diff &= y_edge_diff - 1;
+            }
+        }
+    }
+
+    return;
+}
+
+void FrameRecorder::findRobotChanges(const std::vector<Coordinates>* robot_positions){
+
+    for(int i = 0; i < robot_positions->size(); i++){
+        Coordinates last_position = (i < last_positions.size()) ? last_positions[i] : NULL_COORDINATE; // robots added since last frame had no position
+
+        if((*robot_positions)[i] != last_position){
+            changes.push_back({(*robot_positions)[i].x, (*robot_positions)[i].y, (uint32_t)(i + 1), fc_Robot, 0, 0});
+        }
+    }
+
+    return;
+}
+
+// ** FrameReader Constructors **
+
+FrameReader::FrameReader(std::string directory): frame_stream(directory + FRAMES_FILE, std::ios::binary){
+
+    frames_open = false;
+    x_size = 0;
+    y_size = 0;
+
+    if(!frame_stream.is_open()){
+        return;
+    }
+
+    FrameHeader header;
+    frame_stream.read((char*)&header, sizeof(FrameHeader));
+
+    if(frame_stream.gcount() != sizeof(FrameHeader) || strncmp(header.magic, "MRFR", 4) != 0 || header.version != FRAME_VERSION || header.index_offset == 0){ // index is only written once recorder has been closed
+        return;
+    }
+
+    x_size = header.x_size;
+    y_size = header.y_size;
+
+    index.resize(header.number_of_frames);
+
+    frame_stream.seekg(header.index_offset);
+    frame_stream.read((char*)index.data(), index.size()*sizeof(FrameIndexEntry));
+
+    if(frame_stream.gcount() != index.size()*sizeof(FrameIndexEntry)){
+        index.clear();
+        return;
+    }
+
+    frames_open = true;
+}
+
+// ** Read Functions **
+
+bool FrameReader::readFrame(unsigned int frame_number, Frame* F){
+
+    if(!frames_open || frame_number >= index.size()){
+        return false;
+    }
+
+    unsigned int keyframe = index[frame_number].keyframe;
+    unsigned int next_frame; // first frame whose changes have to be applied
+
+    if(F->frame_number >= 0 && F->frame_number <= frame_number && index[F->frame_number].keyframe == keyframe && F->Map.getXSize() == x_size && F->Map.getYSize() == y_size){ // continuing from frame already held by F
+        next_frame = F->frame_number + 1;
+    }
+    else{
+        readKeyframe(keyframe, F);
+        next_frame = keyframe + 1;
+    }
+
+    for(unsigned int i = next_frame; i <= frame_number; i++){
+        applyChanges(i, F);
+    }
+
+    F->frame_number = frame_number;
+    F->turn = index[frame_number].turn;
+
+    return true;
+}
+
+void FrameReader::readKeyframe(unsigned int frame_number, Frame* F){
+
+    frame_stream.seekg(index[frame_number].offset);
+
+    uint32_t number_of_robots = 0;
+    frame_stream.read((char*)&number_of_robots, sizeof(uint32_t));
+
+    F->robot_positions.resize(number_of_robots);
+
+    for(int i = 0; i < number_of_robots; i++){
+        int32_t cell[2];
+        frame_stream.read((char*)cell, sizeof(cell));
+
+        F->robot_positions[i] = Coordinates(cell[0], cell[1]);
+    }
+
+    if(F->Map.getXSize() != x_size || F->Map.getYSize() != y_size){
+        F->Map = GridGraph(x_size, y_size);
+    }
+
+    int row_words = F->Map.getRowWords();
+
+    if(y_size > 0){
+        frame_stream.read((char*)F->Map.getNodeLowRow(0), row_words*y_size*sizeof(uint64_t));
+        frame_stream.read((char*)F->Map.getNodeHighRow(0), row_words*y_size*sizeof(uint64_t));
+        frame_stream.read((char*)F->Map.getXEdgeRow(0), row_words*y_size*sizeof(uint64_t));
+        frame_stream.read((char*)F->Map.getYEdgeRow(0), row_words*(y_size + 1)*sizeof(uint64_t));
+    }
+
+    return;
+}
+
+void FrameReader::applyChanges(unsigned int frame_number, Frame* F){
+
+    frame_stream.seekg(index[frame_number].offset);
+
+    uint32_t number_of_changes = 0;
+    frame_stream.read((char*)&number_of_changes, sizeof(uint32_t));
+
+    changes.resize(number_of_changes);
+    frame_stream.read((char*)changes.data(), changes.size()*sizeof(FrameChange));
+
+    for(int i = 0; i < changes.size(); i++){
+        FrameChange* change = &changes[i];
+
+        switch(change->type){
+            case fc_Node:
+                F->Map.setNode(change->x, change->y, change->value);
+                break;
+            case fc_XEdge:
+                F->Map.setXEdge(change->x, change->y, change->value);
+                break;
+            case fc_YEdge:
+                F->Map.setYEdge(change->x, change->y, change->value);
+                break;
+            case fc_Robot:
+                if(F->robot_positions.size() < change->robot_id){ // robot was added since last keyframe
+                    F->robot_positions.resize(change->robot_id, NULL_COORDINATE);
+                }
+
+                F->robot_positions[change->robot_id - 1] = Coordinates(change->x, change->y);
+                break;
+        }
+    }
+
+    return;
+}
+
+// ** Frame Export Functions **
+
+std::string printFrame(Frame* F){
+
+    int x_size = F->Map.getXSize();
+    int y_size = F->Map.getYSize();
+
+    std::vector<unsigned int> occupants(x_size*y_size, 0); // id of robot shown in each cell, 0 if empty
+
+    for(int i = F->robot_positions.size() - 1; i >= 0; i--){ // lowest id is written last
+        Coordinates C = F->robot_positions[i];
+
+        if(C != NULL_COORDINATE){
+            occupants[C.y*x_size + C.x] = i + 1;
+        }
+    }
+
+    std::stringstream string_stream;
+
+    for(int y = 0; y < y_size + 1; y++){
+        for(int x = 0; x < x_size; x++){ // printing the horizontal walls of row
+            string_stream << (F->Map.getYEdge(x, y) ? "+---" : "+   ");
+        }
+        string_stream << "+\n";
+
+        if(y == y_size){ // last row only has a southern wall
+            break;
+        }
+
+        for(int x = 0; x < x_size + 1; x++){ // printing vertical walls and contents of each node
+            string_stream << (F->Map.getXEdge(x, y) ? "|" : " ");
+
+            if(x >= x_size){ // outside of maze
+                string_stream << " ";
+            }
+            else if(occupants[y*x_size + x] != 0){
+                string_stream << fmt::format("{0:2d} ", occupants[y*x_size + x]);
+            }
+            else if(F->Map.getNode(x, y) == 0){ // unseen and unexplored
+                string_stream << " X ";
+            }
+            else if(F->Map.getNode(x, y) == 2){ // seen but not explored
+                string_stream << " * ";
+            }
+            else{
+                string_stream << "   ";
+            }
+        }
+        string_stream << "\n";
+    }
+
+    return string_stream.str();
+}
+
+bool exportFramePrintOuts(std::string directory){
+
+    FrameReader Reader(directory);
+
+    if(!Reader.isOpen()){
+        return false;
+    }
+
+    std::filesystem::create_directories(directory + "printouts");
+
+    Frame F;
+
+    for(unsigned int i = 0; i < Reader.getNumberofFrames(); i++){
+        Reader.readFrame(i, &F); // frames are read in order so only changes are applied
+
+        std::ofstream printout_file(directory + "printouts/printout_" + std::to_string(i + 1) + ".txt");
+
+        if(!printout_file.is_open()){
+            return false;
+        }
+
+        printout_file << "*Turn_" << F.turn << "*\n" << printFrame(&F);
+    }
+
+    return true;
+}
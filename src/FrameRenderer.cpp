@@ -0,0 +1,319 @@
+#include "FrameRenderer.h"
+
+#include <iostream>
+#include <filesystem>
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+
+#include "TurnExecutor.h"
+
+const PaletteColor render_palette[PALETTE_SIZE] = {
+    {255, 255, 255}, // rc_Explored
+    {0, 0, 0}, // rc_Wall
+    {110, 110, 110}, // rc_Unseen
+    {255, 214, 102}, // rc_Seen
+    {230, 25, 75}, // robot colors
+    {60, 180, 75},
+    {0, 130, 200},
+    {245, 130, 48},
+    {145, 30, 180},
+    {70, 240, 240},
+    {240, 50, 230},
+    {128, 0, 0},
+    {0, 128, 128},
+    {170, 110, 40},
+    {0, 0, 128},
+    {255, 0, 255} // GIF_TRANSPARENT, never drawn
+};
+
+// ** FrameRenderer Constructors **
+
+FrameRenderer::FrameRenderer(int x_size, int y_size, int cell_size){
+    this->x_size = x_size;
+    this->y_size = y_size;
+    this->cell_size = cell_size;
+}
+
+// ** Render Functions **
+
+void FrameRenderer::renderFrame(const Frame* F, PaletteImage* Image){
+
+    int width = getWidth();
+    Image->resize(width, getHeight());
+
+    for(int y = 0; y < y_size + 1; y++){ // corners are always drawn
+        for(int x = 0; x < x_size + 1; x++){
+            Image->pixels[(size_t)y*cell_size*width + x*cell_size] = rc_Wall;
+        }
+    }
+
+    for(int y = 0; y < y_size; y++){
+        for(int x = 0; x < x_size; x++){
+            drawCell(&F->Map, x, y, Image);
+        }
+    }
+
+    for(int i = F->robot_positions.size() - 1; i >= 0; i--){ // lowest id is drawn last, matching printouts
+        if(F->robot_positions[i] != NULL_COORDINATE){ // robot has not been removed
+            drawRobot(i + 1, F->robot_positions[i], Image);
+        }
+    }
+
+    return;
+}
+
+void FrameRenderer::renderChanges(const Frame* F, const Frame* Previous, PaletteImage* Image){
+
+    const GridGraph* Map = &F->Map;
+    const GridGraph* Previous_Map = &Previous->Map;
+
+    int row_words = Map->getRowWords();
+
+    std::vector<Coordinates> changed_cells; // cells which have to be drawn again, a cell can be listed more than once
+
+    for(int y = 0; y < y_size + 1; y++){ // comparing maps a word at a time
+        for(int w = 0; w < row_words; w++){
+            if(y < y_size){
+                uint64_t cell_diff = (Map->getNodeLowRow(y)[w] ^ Previous_Map->getNodeLowRow(y)[w]) | (Map->getNodeHighRow(y)[w] ^ Previous_Map->getNodeHighRow(y)[w])
+                                   | (Map->getXEdgeRow(y)[w] ^ Previous_Map->getXEdgeRow(y)[w]);
+
+                while(cell_diff != 0){
+                    int x = w*64 + __builtin_ctzll(cell_diff);
+                    changed_cells.push_back(Coordinates(std::min(x, x_size - 1), y)); // eastern border is owned by last cell of row
+                    cell_diff &= cell_diff - 1;
+                }
+            }
+
+            uint64_t y_edge_diff = Map->getYEdgeRow(y)[w] ^ Previous_Map->getYEdgeRow(y)[w];
+
+            while(y_edge_diff != 0){
+                int x = w*64 + __builtin_ctzll(y_edge_diff);
+                changed_cells.push_back(Coordinates(x, std::min(y, y_size - 1))); // southern border is owned by last row
+                y_edge_diff &= y_edge_diff - 1;
+            }
+        }
+    }
+
+    int num_of_robots = std::max(F->robot_positions.size(), Previous->robot_positions.size());
+
+    for(int i = 0; i < num_of_robots; i++){ // cells robots left and entered
+        Coordinates position = (i < F->robot_positions.size()) ? F->robot_positions[i] : NULL_COORDINATE;
+        Coordinates previous_position = (i < Previous->robot_positions.size()) ? Previous->robot_positions[i] : NULL_COORDINATE;
+
+        if(position != previous_position){
+            if(position != NULL_COORDINATE){
+                changed_cells.push_back(position);
+            }
+
+            if(previous_position != NULL_COORDINATE){
+                changed_cells.push_back(previous_position);
+            }
+        }
+    }
+
+    if(changed_cells.size() > (x_size*y_size)/4){ // drawing whole frame is cheaper than searching a long list of cells for robots
+        renderFrame(F, Image);
+        return;
+    }
+
+    for(int i = 0; i < changed_cells.size(); i++){
+        drawCell(Map, changed_cells[i].x, changed_cells[i].y, Image);
+    }
+
+    for(int i = F->robot_positions.size() - 1; i >= 0; i--){ // robots in cells which were drawn again are drawn on top of them
+        Coordinates C = F->robot_positions[i];
+
+        if(C != NULL_COORDINATE && std::find(changed_cells.begin(), changed_cells.end(), C) != changed_cells.end()){
+            drawRobot(i + 1, C, Image);
+        }
+    }
+
+    return;
+}
+
+void FrameRenderer::drawCell(const GridGraph* Map, int x, int y, PaletteImage* Image){
+
+    int width = Image->width;
+    uint8_t color = getNodeColor(Map, x, y);
+    uint8_t* corner = &Image->pixels[(size_t)y*cell_size*width + x*cell_size]; // north west corner of cell
+
+    memset(corner + 1, Map->getYEdge(x, y) ? rc_Wall : color, cell_size - 1); // northern wall
+
+    for(int k = 1; k < cell_size; k++){
+        uint8_t* row = corner + (size_t)k*width;
+
+        row[0] = Map->getXEdge(x, y) ? rc_Wall : color; // western wall
+        memset(row + 1, color, cell_size - 1);
+
+        if(x == x_size - 1){ // eastern border
+            row[cell_size] = Map->getXEdge(x + 1, y) ? rc_Wall : color;
+        }
+    }
+
+    if(y == y_size - 1){ // southern border
+        memset(corner + (size_t)cell_size*width + 1, Map->getYEdge(x, y + 1) ? rc_Wall : color, cell_size - 1);
+    }
+
+    return;
+}
+
+void FrameRenderer::drawRobot(unsigned int robot_id, Coordinates C, PaletteImage* Image){
+
+    int inset = (cell_size - 1)/4; // robots are drawn as a square in the middle of their cell
+    uint8_t color = rc_Robot + (robot_id - 1)%(GIF_TRANSPARENT - rc_Robot);
+
+    for(int py = C.y*cell_size + 1 + inset; py < (C.y + 1)*cell_size - inset; py++){
+        memset(&Image->pixels[(size_t)py*Image->width + C.x*cell_size + 1 + inset], color, cell_size - 1 - 2*inset);
+    }
+
+    return;
+}
+
+uint8_t FrameRenderer::getNodeColor(const GridGraph* Map, int x, int y){
+
+    switch(Map->getNode(x, y)){
+        case 0: // unseen and unexplored
+            return rc_Unseen;
+        case 2: // seen but not explored
+            return rc_Seen;
+        default:
+            return rc_Explored;
+    }
+}
+
+// ** Batch Rendering Functions **
+
+bool renderFrames(std::string directory, int image_format, int cell_size, int num_of_threads){
+
+    FrameReader Reader(directory);
+
+    if(!Reader.isOpen() || Reader.getXSize() <= 0 || Reader.getYSize() <= 0 || cell_size < 2){
+        return false;
+    }
+
+    FrameRenderer Renderer(Reader.getXSize(), Reader.getYSize(), cell_size);
+
+    if(image_format == if_GIF && (Renderer.getWidth() > 65535 || Renderer.getHeight() > 65535)){ // gif sizes are 16 bits
+        return false;
+    }
+
+    std::ofstream gif_file;
+    std::vector<uint8_t> gif_data;
+
+    if(image_format == if_GIF){
+        gif_file.open(directory + RENDER_GIF_FILE, std::ios::binary);
+
+        if(!gif_file.is_open()){
+            return false;
+        }
+
+        encodeGIFHeader(Renderer.getWidth(), Renderer.getHeight(), render_palette, &gif_data);
+        gif_file.write((const char*)gif_data.data(), gif_data.size());
+    }
+    else{
+        std::filesystem::create_directories(directory + RENDER_FRAMES_DIRECTORY);
+    }
+
+    std::string extension = (image_format == if_PNG) ? ".png" : ".ppm";
+
+    TurnExecutor Executor(num_of_threads);
+
+    struct ChunkState{ // state of a task rendering a run of consecutive frames
+        PaletteImage Image;
+        PaletteImage Previous; // render of frame before Image
+        std::vector<uint8_t> encoded; // gif frames of chunk, or image file being written
+    };
+
+    int num_of_chunks = Executor.getNumberofThreads()*4; // enough chunks for every thread to steal work
+    int batch_size = num_of_chunks*RENDER_CHUNK_SIZE;
+
+    std::vector<Frame> frames(batch_size + 1); // frames[0] holds last frame of previous batch
+    std::vector<ChunkState> chunks(num_of_chunks);
+    std::atomic<bool> write_failed(false);
+
+    Frame Current; // frames are read in order so only changes since previous frame are applied
+    unsigned int number_of_frames = Reader.getNumberofFrames();
+
+    for(unsigned int first = 0; first < number_of_frames; first += batch_size){
+        int count = std::min((unsigned int)batch_size, number_of_frames - first);
+
+        if(first > 0){ // only the last batch can be smaller than batch_size
+            std::swap(frames[0], frames[batch_size]);
+        }
+
+        for(int i = 1; i <= count; i++){
+            Reader.readFrame(first + i - 1, &Current);
+            frames[i] = Current;
+        }
+
+        int chunks_in_batch = (count + RENDER_CHUNK_SIZE - 1)/RENDER_CHUNK_SIZE;
+
+        Executor.runPhase(chunks_in_batch, [&](int c){ // each chunk is drawn from scratch once, after which only changed cells are drawn
+            ChunkState* Chunk = &chunks[c];
+
+            int chunk_start = 1 + c*RENDER_CHUNK_SIZE;
+            int chunk_end = std::min(chunk_start + RENDER_CHUNK_SIZE, count + 1);
+            bool has_previous = (first + chunk_start - 1 > 0); // false only for first frame of simulation
+
+            if(has_previous){
+                Renderer.renderFrame(&frames[chunk_start - 1], &Chunk->Previous);
+            }
+
+            Chunk->encoded.clear();
+
+            for(int i = chunk_start; i < chunk_end; i++){
+                if(has_previous){
+                    Chunk->Image = Chunk->Previous;
+                    Renderer.renderChanges(&frames[i], &frames[i - 1], &Chunk->Image);
+                }
+                else{
+                    Renderer.renderFrame(&frames[i], &Chunk->Image);
+                }
+
+                if(image_format == if_GIF){ // gif frames only hold pixels which changed since previous frame
+                    encodeGIFFrame(&Chunk->Image, has_previous ? &Chunk->Previous : NULL, RENDER_GIF_DELAY, &Chunk->encoded);
+                }
+                else{
+                    Chunk->encoded.clear();
+
+                    if(image_format == if_PNG){
+                        encodePNG(&Chunk->Image, render_palette, &Chunk->encoded);
+                    }
+                    else{
+                        encodePPM(&Chunk->Image, render_palette, &Chunk->encoded);
+                    }
+
+                    if(!writeFile(directory + RENDER_FRAMES_DIRECTORY + "frame_" + std::to_string(first + i) + extension, &Chunk->encoded)){
+                        write_failed = true;
+                    }
+                }
+
+                std::swap(Chunk->Image, Chunk->Previous);
+                has_previous = true;
+            }
+        });
+
+        if(image_format == if_GIF){
+            for(int c = 0; c < chunks_in_batch; c++){ // chunks are written in order
+                gif_file.write((const char*)chunks[c].encoded.data(), chunks[c].encoded.size());
+            }
+        }
+
+        std::cout << "Rendered " << first + count << "/" << number_of_frames << " frames\r" << std::flush;
+    }
+
+    std::cout << "\n";
+
+    if(image_format == if_GIF){
+        gif_data.clear();
+        encodeGIFTrailer(&gif_data);
+        gif_file.write((const char*)gif_data.data(), gif_data.size());
+
+        if(!gif_file.good()){
+            write_failed = true;
+        }
+    }
+
+    return !write_failed;
+}
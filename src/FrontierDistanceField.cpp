@@ -0,0 +1,388 @@
+#include "FrontierDistanceField.h"
+
+FrontierDistanceField::FrontierDistanceField(const GridGraph* map){
+
+    Map = map;
+    x_size = map->getXSize();
+    y_size = map->getYSize();
+
+    Wavefront = WavefrontBFS(x_size, y_size);
+
+    excluded.assign(x_size*y_size, 0); // no cells excluded until told otherwise
+
+    rebuild(); // building field from current contents of map
+}
+
+// ** Cell Rules **
+
+void FrontierDistanceField::loadLinks(int i){ // reads which sides of cell have no wall from map
+
+    int x = i % x_size;
+    int y = i / x_size;
+
+    links[i] = 0;
+
+    if(y > 0 && !Map->getYEdge(x, y)){ // north
+        links[i] |= 1;
+    }
+    if(y < y_size - 1 && !Map->getYEdge(x, y + 1)){ // south
+        links[i] |= 2;
+    }
+    if(x > 0 && !Map->getXEdge(x, y)){ // east
+        links[i] |= 4;
+    }
+    if(x < x_size - 1 && !Map->getXEdge(x + 1, y)){ // west
+        links[i] |= 8;
+    }
+
+    return;
+}
+
+int FrontierDistanceField::getConnectedNeighbours(int i, int* neighbours){ // gathers neighbours with no wall between them and cell, returns number gathered
+                                                                         // neighbours are gathered in the order north, south, east, west
+    int num_neighbours = 0;
+
+    if(links[i] & 1){
+        neighbours[num_neighbours++] = i - x_size;
+    }
+    if(links[i] & 2){
+        neighbours[num_neighbours++] = i + x_size;
+    }
+    if(links[i] & 4){
+        neighbours[num_neighbours++] = i - 1;
+    }
+    if(links[i] & 8){
+        neighbours[num_neighbours++] = i + 1;
+    }
+
+    return num_neighbours;
+}
+
+bool FrontierDistanceField::shouldBeSource(int i){
+    return (Map->getNode(i % x_size, i / x_size) == 2 && !excluded[i]);
+}
+
+// ** Maintenance Functions **
+
+void FrontierDistanceField::rebuild(){ // rebuilds entire field from map
+
+    update_buckets.clear(); // discarding any queued updates
+    first_bucket = 0;
+    cells_updated = 0;
+
+    links.resize(x_size*y_size);
+
+    for(int i = 0; i < x_size*y_size; i++){
+        loadLinks(i);
+    }
+
+    std::vector<Coordinates> sources;
+
+    for(int i = 0; i < x_size*y_size; i++){ // every valid unexplored cell is a source
+        if(shouldBeSource(i)){
+            sources.push_back(toCoordinates(i));
+        }
+    }
+
+    Wavefront.computeDistanceField(Map, wf_FrontierMap, &sources, &distance); // distances only travel into explored cells, the same as propagate
+
+    // ordering reached cells by distance, so every cell is given an owner after the neighbour it was reached from
+    std::vector<int> cells_at_distance; // number of cells at each distance, then index of first cell at each distance within ordered_cells
+
+    for(int i = 0; i < x_size*y_size; i++){
+        if(distance[i] >= 0){
+            if(distance[i] >= cells_at_distance.size()){
+                cells_at_distance.resize(distance[i] + 1, 0);
+            }
+            cells_at_distance[distance[i]]++;
+        }
+    }
+
+    int num_reached = 0;
+
+    for(int d = 0; d < cells_at_distance.size(); d++){
+        int num_at_distance = cells_at_distance[d];
+        cells_at_distance[d] = num_reached;
+        num_reached += num_at_distance;
+    }
+
+    std::vector<int> ordered_cells(num_reached);
+
+    for(int i = 0; i < x_size*y_size; i++){
+        if(distance[i] >= 0){
+            ordered_cells[cells_at_distance[distance[i]]++] = i;
+        }
+    }
+
+    owner.assign(x_size*y_size, -1);
+
+    for(int k = 0; k < num_reached; k++){ // taking owner of any connected neighbour one closer to a source
+        int i = ordered_cells[k];
+
+        if(distance[i] == 0){
+            owner[i] = i;
+            continue;
+        }
+
+        int neighbours[4];
+        int num_neighbours = getConnectedNeighbours(i, neighbours);
+
+        for(int k = 0; k < num_neighbours && owner[i] < 0; k++){
+            if(distance[neighbours[k]] == distance[i] - 1){
+                owner[i] = owner[neighbours[k]];
+            }
+        }
+    }
+
+    cells_updated = num_reached;
+
+    return;
+}
+
+void FrontierDistanceField::cellChanged(int x, int y){ // updates field after state or walls of a cell have changed
+    cells_updated = 0;
+
+    int i = toIndex(x, y);
+
+    // walls of a cell are shared with its neighbours, so their sides facing it are read again too
+    loadLinks(i);
+
+    if(y > 0){
+        loadLinks(i - x_size);
+    }
+    if(y < y_size - 1){
+        loadLinks(i + x_size);
+    }
+    if(x > 0){
+        loadLinks(i - 1);
+    }
+    if(x < x_size - 1){
+        loadLinks(i + 1);
+    }
+
+    updateCell(i);
+
+    return;
+}
+
+void FrontierDistanceField::setExcludedCells(const std::vector<Coordinates>* cells){ // replaces previously excluded cells
+    cells_updated = 0;
+
+    std::vector<Coordinates> previous_cells = excluded_cells;
+
+    for(int i = 0; i < previous_cells.size(); i++){
+        excluded[toIndex(previous_cells[i].x, previous_cells[i].y)] = 0;
+    }
+
+    for(int i = 0; i < cells->size(); i++){
+        excluded[toIndex((*cells)[i].x, (*cells)[i].y)] = 1;
+    }
+
+    excluded_cells = *cells;
+
+    // updating cells which may have gained or lost their source status
+    // cells which have not changed are left untouched by updateCell
+    for(int i = 0; i < previous_cells.size(); i++){
+        updateCell(toIndex(previous_cells[i].x, previous_cells[i].y));
+    }
+
+    for(int i = 0; i < cells->size(); i++){
+        updateCell(toIndex((*cells)[i].x, (*cells)[i].y));
+    }
+
+    return;
+}
+
+// ** Query Functions **
+
+bool FrontierDistanceField::getPathToFrontier(Coordinates start, std::deque<Coordinates>* path){ // follows field down to closest frontier cell
+
+    path->clear();
+
+    int curr = toIndex(start.x, start.y);
+
+    if(distance[curr] <= 0){ // no frontier can be reached or start is already a frontier cell
+        return false;
+    }
+
+    while(distance[curr] > 0){ // stepping to any neighbour one closer to a frontier cell until a frontier cell is reached
+        int next = -1;
+
+        int neighbours[4];
+        int num_neighbours = getConnectedNeighbours(curr, neighbours);
+
+        for(int k = 0; k < num_neighbours && next < 0; k++){
+            if(distance[neighbours[k]] == distance[curr] - 1){
+                next = neighbours[k];
+            }
+        }
+
+        if(next < 0){
+            throw "Critical Error: FrontierDistanceField has a cell with no neighbour closer to a frontier";
+        }
+
+        path->push_back(toCoordinates(next));
+        curr = next;
+    }
+
+    return true;
+}
+
+// ** Update Functions **
+
+void FrontierDistanceField::updateCell(int i){ // updates a single cell and spreads any resulting changes
+
+    std::vector<int> reset_cells; // cells whose distance must be found again
+
+    if(isSource(i) && !shouldBeSource(i)){ // source has been explored or excluded
+        resetRegion(i, &reset_cells);
+    }
+    else if(!isSource(i) && distance[i] >= 0 && !isExplored(i)){ // cell can no longer carry a distance
+        resetRegion(owner[i], &reset_cells);
+    }
+
+    if(!isSource(i) && shouldBeSource(i)){ // new source
+        distance[i] = 0;
+        owner[i] = i;
+        queueCell(i, 0);
+        cells_updated++;
+    }
+
+    for(int k = 0; k < reset_cells.size(); k++){ // queueing cells bordering the reset region, so propagate repairs it in order of distance
+        queueNeighbours(reset_cells[k]);
+    }
+
+    if(isExplored(i)){ // walls of cell may have been removed, so it may be reachable from new neighbours or provide a shorter route to them
+        relaxFromNeighbours(i);
+
+        if(distance[i] >= 0){
+            queueCell(i, distance[i]);
+        }
+    }
+
+    propagate();
+
+    return;
+}
+
+void FrontierDistanceField::resetRegion(int source, std::vector<int>* reset_cells){ // clears every cell which was reached from source
+                                                                                    // every such cell has a connected neighbour reached from the same source which is one closer to it
+                                                                                    // so they can all be found by searching outwards from source
+    int first_cell = reset_cells->size(); // reset cells are searched outwards in the order they were reset
+
+    distance[source] = -1;
+    owner[source] = -1;
+    reset_cells->push_back(source);
+
+    for(int k = first_cell; k < reset_cells->size(); k++){
+        int curr = (*reset_cells)[k];
+
+        int neighbours[4];
+        int num_neighbours = getConnectedNeighbours(curr, neighbours);
+
+        for(int k = 0; k < num_neighbours; k++){
+            int n = neighbours[k];
+
+            if(owner[n] == source){
+                distance[n] = -1;
+                owner[n] = -1;
+                reset_cells->push_back(n);
+            }
+        }
+    }
+
+    return;
+}
+
+void FrontierDistanceField::queueNeighbours(int i){ // queues every connected neighbour of cell with a known distance
+                                                   // a cell repaired from a neighbour before that neighbour is final would have to be repaired again
+    int neighbours[4];
+    int num_neighbours = getConnectedNeighbours(i, neighbours);
+
+    for(int k = 0; k < num_neighbours; k++){
+        if(distance[neighbours[k]] >= 0){
+            queueCell(neighbours[k], distance[neighbours[k]]);
+        }
+    }
+
+    return;
+}
+
+void FrontierDistanceField::relaxFromNeighbours(int i){ // sets distance of cell from its closest neighbour with a known distance
+
+    if(!isExplored(i)){ // only explored cells carry distances from a source
+        return;
+    }
+
+    int best_distance = -1;
+    int best_owner = -1;
+
+    int neighbours[4];
+    int num_neighbours = getConnectedNeighbours(i, neighbours);
+
+    for(int k = 0; k < num_neighbours; k++){
+        int n = neighbours[k];
+
+        if(distance[n] >= 0 && (best_distance < 0 || distance[n] + 1 < best_distance)){
+            best_distance = distance[n] + 1;
+            best_owner = owner[n];
+        }
+    }
+
+    if(best_distance >= 0 && (distance[i] < 0 || best_distance < distance[i])){
+        distance[i] = best_distance;
+        owner[i] = best_owner;
+        queueCell(i, best_distance);
+        cells_updated++;
+    }
+
+    return;
+}
+
+void FrontierDistanceField::queueCell(int i, int d){ // queues cell to be spread from at distance d
+
+    if(d >= update_buckets.size()){
+        update_buckets.resize(d + 1);
+    }
+
+    update_buckets[d].push_back(i);
+    first_bucket = std::min(first_bucket, d);
+
+    return;
+}
+
+void FrontierDistanceField::propagate(){ // spreads queued distances outwards until no cell can be improved
+                                         // every step costs 1, so cells are spread from in order of distance by visiting buckets in order
+    for(int d = first_bucket; d < update_buckets.size(); d++){ // spreading from bucket d only queues cells in bucket d + 1
+        while(!update_buckets[d].empty()){
+            int curr = update_buckets[d].back();
+            update_buckets[d].pop_back();
+
+            if(d != distance[curr]){ // cell has been reset or improved since it was queued
+                continue;
+            }
+
+            int neighbours[4];
+            int num_neighbours = getConnectedNeighbours(curr, neighbours);
+
+            for(int k = 0; k < num_neighbours; k++){
+                int n = neighbours[k];
+
+                if(distance[n] >= 0 && distance[n] <= d + 1){ // neighbour cannot be improved
+                    continue;
+                }
+
+                if(isExplored(n)){ // distances only travel into explored cells
+                    distance[n] = d + 1;
+                    owner[n] = owner[curr];
+                    queueCell(n, d + 1);
+                    cells_updated++;
+                }
+            }
+        }
+    }
+
+    first_bucket = update_buckets.size(); // every bucket is empty
+
+    return;
+}
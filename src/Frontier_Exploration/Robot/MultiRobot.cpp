@@ -3,11 +3,14 @@
 MultiRobot::MultiRobot(int x, int y, RequestHandler* outgoing_req, unsigned int xsize, unsigned int ysize): Robot(x, y, xsize, ysize){
 
     Robot_2_Master_Message_Handler = outgoing_req; // assigning message handler for robot -> master communications
+    Robot_2_Master_Channel = Robot_2_Master_Message_Handler->openChannel(); // robot is the only sender on its own channel
     Master_2_Robot_Message_Handler = new RequestHandler; // assigning message handler for master -> robot communications
 
     accepting_requests = false; // robot needs to be added to RobotMaster before it can accept requests
 
     transaction_counter = 0; // initializing to 0 as no transactions have occured
+
+    job_epoch = 0; // robot has not been given a target by master
 }
 
 MultiRobot::~MultiRobot(){
@@ -29,19 +32,17 @@ bool MultiRobot::move2Cell(Coordinates destination){ // overriden version of mov
 int MultiRobot::getMessagesFromMaster(int current_status){ // checking if RobotMaster wants robot to change states
                                                            // this should only be called if robot is not waiting for a response
 
-    Message* request = Master_2_Robot_Message_Handler->getMessage(); // gathering request from msg_queue
-                                                                     // pointer is gathered so response can be gathered by robot threads
-                                                                     // returned pointer will be NULL is no messages to get
-    
-    int new_robot_status; // return variable to update status in RobotLoop
+    int new_robot_status = current_status; // return variable to update status in RobotLoop, kept if no message changes it
 
-    if(request != NULL){ // if there is a a request to handle, process it
+    if(Master_2_Robot_Message_Handler->drainAll(&received_messages) > 0){ // if there are requests to handle, process them as one batch
 
         last_request_priority = 10; // reseting last_request priority to a high value
                                     // if a received RobotMaster request has lower priority than this value
                                     // set the request priority so only request of same priority value or lower are handled 
         
-        do{ // repeatedly process all messages until there are none left
+        for(int i = 0; i < received_messages.size(); i++){ // process all messages in the order they were sent
+
+            Message* request = &received_messages[i];
 
             if(request->message_type){ // if sent message is a response for a previously sent request
 
@@ -63,14 +64,10 @@ int MultiRobot::getMessagesFromMaster(int current_status){ // checking if RobotM
                 }
             }
 
-            // message has been handled, can delete sent data
-            delete request->msg_data; // deleting data receieved in the request as its no longer needed
-            delete request; // deleting recieved message as no longer needed
-
-            request = Master_2_Robot_Message_Handler->getMessage(); // gather next request to process
             current_status = new_robot_status; // setting new robot status as current status for next iteration through for loop
+        }
 
-        } while(request != NULL); // checking if there is another request to process
+        received_messages.clear(); // capacity is kept for next batch
     }
     else{ // if no message to handle, do nothing and keep current status
         new_robot_status = current_status; // set new robot status status as current status
@@ -80,20 +77,15 @@ int MultiRobot::getMessagesFromMaster(int current_status){ // checking if RobotM
 }
 
 int MultiRobot::handleMasterRequest(Message* request, int current_status){
-    // gathering request type for switch statement
-    m_genericRequest* r = (m_genericRequest*) request->msg_data; // use generic message pointer to gather request type
-
-    int new_robot_status;
 
-    switch (r->request_type){ // determining type of request before processing
+    int new_robot_status = current_status; // keep current status if an undefined request is received
 
-        case updateRobotStateRequest_ID: // update robot state
-        {   
+    std::visit(MessageVisitor{ // determining type of request before processing
+        [&](m_updateRobotStateRequest& data){ // update robot state
             if(last_request_priority >= 1){ // if the current request priority allows for this request to be handled
                 
                 // updating robot state to specified value
-                m_updateRobotStateRequest* data = (m_updateRobotStateRequest*) request->msg_data;
-                new_robot_status = data->target_state;
+                new_robot_status = data.target_state;
                 
                 valid_responses.clear(); // clearing valid_responses to cause any outstanding responses to become stale
                                          // this is done as the update state message overrides any responses after it
@@ -108,73 +100,37 @@ int MultiRobot::handleMasterRequest(Message* request, int current_status){
             else{ // if the request priority is a value which does not allow update robot state request to be handled
                 
             }
+        },
+        [&](auto&){ // other requests are handled by child classes
 
-            break;
         }
-        default:
-        {
-            new_robot_status = current_status; // keep current status if an undefined status is received
-
-            break;
-        }
-    }
+    }, request->msg_data);
     
     return new_robot_status; // returning changes to robot status
 }
 
 int MultiRobot::handleMasterResponse(Message* response, int current_status){
-    // gathering response type for switch statement
-    m_genericRequest* response_data = (m_genericRequest*) response->msg_data; // use generic message pointer to gather request type
 
-    int new_robot_status; // status to be returned
+    int new_robot_status = current_status; // status to be returned, kept if improper response is received
 
-    switch (response_data->request_type){ // determining type of response to process
-        case shutDownRequest_ID:
-        {
+    std::visit(MessageVisitor{ // determining type of response to process
+        [&](m_shutDownResponse&){
             // final response from master received, can exit loop now       
             new_robot_status = s_exit_loop; // setting status to exit loop to cause a loop exit
-            
-            break;
-        }
-        case addRobotRequest_ID: // addRobot response 
-        {   
+        },
+        [&](m_addRobotResponse& message_response){ // addRobot response 
             // This response type assigns a new id to the robot
-
-            m_addRobotResponse* message_response = (m_addRobotResponse*)response_data; // typecasting response data to appropriate format
             
-            id = message_response->robot_id; // assigning id to Robot from RobotMaster's response
+            id = message_response.robot_id; // assigning id to Robot from RobotMaster's response
 
             accepting_requests = true; // robot master has been added to the system meaning it can now accept requests from the RobotMaster
 
-            new_robot_status = current_status; // keep current robot status as master has not told robot to begin exploring
-            
-            break;
-        }
-        case updateGlobalMapRequest_ID: // updateGlobalMapRequest response 
-        {
-            // Empty as currently no response needed
-            // responses will still be recieved to allow for future implementation if needed
+            // keep current robot status as master has not told robot to begin exploring
+        },
+        [&](auto&){ // updateGlobalMap and updateRobotLocation currently need no response, other responses are handled by child classes
 
-            new_robot_status = current_status; // status does not change as this response type is not implemented
-            
-            break;
         }
-        case updateRobotLocationRequest_ID:
-        {
-            // Empty as currently no response needed
-            // responses will still be recieved to allow for future implementation if needed
-
-            new_robot_status = current_status; // status does not change as this response type is not implemented
-
-            break;
-        }
-        default: // TODO: Implement handling if improper messge type is recieved
-        {
-            new_robot_status = current_status; // keep current status if improper response is received
-
-            break;
-        }
-    }
+    }, response->msg_data);
     
     return new_robot_status; // returning changes to robot status
 }
@@ -207,20 +163,15 @@ void MultiRobot::assignIdFromMaster(){
 
     valid_responses.push_back(transaction_counter); // adding transaction to valid responses as response is required
 
-    Message* temp_message = new Message(t_Request, transaction_counter); // buffer to load data into before sending message
-
     // defining new addRobotRequest
-    m_addRobotRequest* message_data = new m_addRobotRequest;
+    m_addRobotRequest message_data;
     
     // gather request data
-    message_data->x = x_position; // adding x position of robot
-    message_data->y = y_position; // adding y position of robot 
-    message_data->robot_request_handler =  Master_2_Robot_Message_Handler; // adding request handler for master -> robot message to [2]
-
-    // attaching message data to request
-    temp_message->msg_data = message_data;
+    message_data.x = x_position; // adding x position of robot
+    message_data.y = y_position; // adding y position of robot 
+    message_data.robot_request_handler =  Master_2_Robot_Message_Handler; // adding request handler for master -> robot message to [2]
 
-    Robot_2_Master_Message_Handler->sendMessage(temp_message); // sending message to robot master
+    Robot_2_Master_Message_Handler->sendMessage(Message(t_Request, transaction_counter, std::move(message_data), NULL, job_epoch), Robot_2_Master_Channel); // sending message to robot master
 
     return;
 }
@@ -232,16 +183,13 @@ void MultiRobot::requestShutDown(){
 
     valid_responses.push_back(transaction_counter); // adding transaction to valid responses as response is required
 
-    Message* temp_message = new Message(t_Request, transaction_counter); // buffer to load data into before sending message
-
     // defining new shutDownRequest
-    m_shutDownRequest* message_data = new m_shutDownRequest;
+    m_shutDownRequest message_data;
 
     // attaching message data to request
-    message_data->robot_id = id; // adding id of robot sending request
-    temp_message->msg_data = message_data;
+    message_data.robot_id = id; // adding id of robot sending request
     
-    Robot_2_Master_Message_Handler->sendMessage(temp_message); // sending message to message queue
+    Robot_2_Master_Message_Handler->sendMessage(Message(t_Request, transaction_counter, std::move(message_data), NULL, job_epoch), Robot_2_Master_Channel); // sending message to message queue
 
     return;
 }
@@ -251,17 +199,12 @@ void MultiRobot::requestRobotLocationUpdate(){
     transaction_counter++; // incrementing transaction counter as new request is being sent
 
     // sending message with new robot position
-    Message* temp_message = new Message(t_Request, transaction_counter); // buffer to load data into before sending message
-
-    // attaching message data to request
-    m_updateRobotLocationRequest* message_data = new m_updateRobotLocationRequest;    
-    message_data->robot_id = id; // adding id of robot sending request
+    m_updateRobotLocationRequest message_data;    
+    message_data.robot_id = id; // adding id of robot sending request
     Coordinates robot_cords(x_position,y_position);// gathering robots current coordinates
-    message_data->new_robot_location = robot_cords; // adding robot location
-
-    temp_message->msg_data = message_data;
+    message_data.new_robot_location = robot_cords; // adding robot location
     
-    Robot_2_Master_Message_Handler->sendMessage(temp_message); // sending message to message queue
+    Robot_2_Master_Message_Handler->sendMessage(Message(t_Request, transaction_counter, std::move(message_data), NULL, job_epoch), Robot_2_Master_Channel); // sending message to message queue
 
     return;
 }
@@ -271,35 +214,43 @@ void MultiRobot::requestGlobalMapUpdate(std::vector<bool> connection_data){
     transaction_counter++; // incrementing transaction counter as new request is being sent
 
     // sending message with scanned maze information
-    Message* temp_message = new Message(t_Request, transaction_counter); // buffer to load data into before sending message
-
-    // attaching message data to request
-    m_updateGlobalMapRequest* message_data = new m_updateGlobalMapRequest;  
-    message_data->robot_id = id; // adding id of robot sending request
-    message_data->wall_info = connection_data; // adding vector containing information on walls surrounding robot to [1]
+    m_updateGlobalMapRequest message_data;  
+    message_data.robot_id = id; // adding id of robot sending request
+    for(int i = 0; i < 4; i++){ // adding information on walls surrounding robot
+        message_data.wall_info[i] = connection_data[i];
+    }
     Coordinates robot_cords(x_position,y_position);// gathering robots current coordinates
-    message_data->cords = robot_cords; // current coordinates of where the read occured
-
-    temp_message->msg_data = message_data;
+    message_data.cords = robot_cords; // current coordinates of where the read occured
     
-    Robot_2_Master_Message_Handler->sendMessage(temp_message); // sending message to message queue
+    Robot_2_Master_Message_Handler->sendMessage(Message(t_Request, transaction_counter, std::move(message_data), NULL, job_epoch), Robot_2_Master_Channel); // sending message to message queue
 
     return;
 }
 
-void MultiRobot::updateLocalMap(std::vector<Coordinates>* map_info, std::vector<std::vector<bool>>* edge_info, std::vector<char>* map_status){
+void MultiRobot::updateLocalMap(const MessagePayload* map){
+
+    for(int i = 0; i < map->map_coordinates.size(); i++){ // iterate through node information
+        int x = map->map_coordinates[i].x; // gathering x and y position for data transfer
+        int y = map->map_coordinates[i].y;
+
+        const char* walls = &map->map_walls[4 * i]; // 4 walls of node
 
-    for(int i = 0; i < map_info->size(); i++){ // iterate through node information
-        int x = (*map_info)[i].x; // gathering x and y position for data transfer
-        int y = (*map_info)[i].y;
+        bool cell_changed = (LocalMap->getNode(x, y) != map->map_status[i]); // tracking whether cell differs from LocalMap for nearest unknown cell search
 
-        LocalMap->nodes[y][x] = (*map_status)[i]; // passing map status of cell into LocalMap
+        LocalMap->setNode(x, y, map->map_status[i]); // passing map status of cell into LocalMap
         
-        if((*map_status)[i] == 1){ // if the node is valid, pass various x and y edge information into LocalMap
-            LocalMap->y_edges[y][x] = (*edge_info)[i][0]; // passing northern edge info into LocalMap
-            LocalMap->y_edges[y + 1][x] = (*edge_info)[i][1]; // passing southern edge info into map
-            LocalMap->x_edges[y][x] = (*edge_info)[i][2]; // passing eastern edge info into map
-            LocalMap->x_edges[y][x + 1] = (*edge_info)[i][3]; // passing western edge info into map
+        if(map->map_status[i] == 1){ // if the node is valid, pass various x and y edge information into LocalMap
+            cell_changed = cell_changed || LocalMap->getYEdge(x, y) != walls[0] || LocalMap->getYEdge(x, y + 1) != walls[1] 
+                                        || LocalMap->getXEdge(x, y) != walls[2] || LocalMap->getXEdge(x + 1, y) != walls[3];
+
+            LocalMap->setYEdge(x, y, walls[0]); // passing northern edge info into LocalMap
+            LocalMap->setYEdge(x, y + 1, walls[1]); // passing southern edge info into map
+            LocalMap->setXEdge(x, y, walls[2]); // passing eastern edge info into map
+            LocalMap->setXEdge(x + 1, y, walls[3]); // passing western edge info into map
+        }
+
+        if(cell_changed){
+            localMapCellChanged(x, y);
         }
     }   
     
@@ -19,17 +19,14 @@ void MultiRobot_C::requestMove2Cell(Coordinates target_cell){
 
     valid_responses.push_back(transaction_counter); // adding transaction to valid responses as response is required
 
-    Message* temp_message = new Message(t_Request, transaction_counter);
-
     // defining new Move2CellRequest
-    m_move2CellRequest* message_data = new m_move2CellRequest;
+    m_move2CellRequest message_data;
 
     // attaching message data to request
-    message_data->robot_id = id; // adding id of robot
-    message_data->target_cell = target_cell; // adding target destination of robot
-    temp_message->msg_data = message_data;
+    message_data.robot_id = id; // adding id of robot
+    message_data.target_cell = target_cell; // adding target destination of robot
 
-    Robot_2_Master_Message_Handler->sendMessage(temp_message); // sending message to robot controller
+    Robot_2_Master_Message_Handler->sendMessage(Message(t_Request, transaction_counter, std::move(message_data), NULL, job_epoch), Robot_2_Master_Channel); // sending message to robot controller
     
     return;
 }
@@ -40,16 +37,13 @@ void MultiRobot_C::requestGetMap(){
 
     valid_responses.push_back(transaction_counter); // adding transaction to valid responses as response is required
 
-    Message* temp_message = new Message(t_Request, transaction_counter);
-
-    m_getMapRequest* message_data = new m_getMapRequest;
+    m_getMapRequest message_data;
 
-    message_data->robot_id = id; // adding id of robot
-    message_data->current_cell = Coordinates(x_position, y_position); // adding current position
-    message_data->target_cell = target_2_pathfind; // adding target cell 
+    message_data.robot_id = id; // adding id of robot
+    message_data.current_cell = Coordinates(x_position, y_position); // adding current position
+    message_data.target_cell = target_2_pathfind; // adding target cell
 
-    temp_message->msg_data = message_data;
-    Robot_2_Master_Message_Handler->sendMessage(temp_message); // sending message to robot controller
+    Robot_2_Master_Message_Handler->sendMessage(Message(t_Request, transaction_counter, std::move(message_data), NULL, job_epoch), Robot_2_Master_Channel); // sending message to robot controller
 
     return;
 }
@@ -59,14 +53,12 @@ int MultiRobot_C::handleCollisionResponse(Message* response, int current_status)
                                                                                   // status is only updated if collision request is received
 
     // gathering response type for switch statement
-    m_genericRequest* response_data = (m_genericRequest*) response->msg_data; // use generic message pointer to gather request type
+    int new_robot_status = current_status;
 
-    int new_robot_status;
-
-    switch(response_data->request_type){
+    switch(getRequestType(response->msg_data)){
         case move2CellRequest_ID:
         {
-            m_move2CellResponse* message_response = (m_move2CellResponse*)response_data;
+            m_move2CellResponse* message_response = &std::get<m_move2CellResponse>(response->msg_data);
             bool movement_can_occur = message_response->can_movement_occur; // gather whether movement can occur
 
             if(movement_can_occur){ // if movement can occur, move to next cell in planned_path
@@ -80,9 +72,7 @@ int MultiRobot_C::handleCollisionResponse(Message* response, int current_status)
         }
         case getMapRequest_ID:
         {
-            m_getMapResponse* message_response = (m_getMapResponse*)response_data;
-
-            updateLocalMap(&message_response->map_coordinates, &message_response->map_connections, &message_response->map_status); // updating local map with recieved information
+            updateLocalMap(response->Payload); // updating local map with recieved information
 
             new_robot_status = s_pathfind2target; // attempt to pathfind to received target again
 
@@ -101,17 +91,18 @@ int MultiRobot_C::handleCollisionResponse(Message* response, int current_status)
 int MultiRobot_C::handleCollisionRequest(Message* request, int current_status){
 
     // gathering request type for switch statement
-    m_genericRequest* r = (m_genericRequest*) request->msg_data; // use generic message pointer to gather request type
+    int new_robot_status = current_status; // kept if request cannot be handled
 
-    int new_robot_status;
-
-    switch (r->request_type){ // determining type of request before processing
+    switch (getRequestType(request->msg_data)){ // determining type of request before processing
 
         case setTargetCell_ID: // setTargetCell
         {
+            m_setTargetCellRequest* data = &std::get<m_setTargetCellRequest>(request->msg_data);
+
+            job_epoch = data->job_epoch; // master ignores requests sent with an older epoch, so following requests must carry this one
+
             if(last_request_priority >= 1){ // if the current request priority allows for this request to be handled
                 // updating robot state to specified value
-                m_setTargetCellRequest* data = (m_setTargetCellRequest*) request->msg_data;
                 target_2_pathfind = data->new_target_cell; // passing new target onto robot
 
                 planned_path.clear(); // clearing planned path as robot needs to create a new path to the new target
@@ -91,6 +91,12 @@ void MultiRobot_C_CellReservation::computeRobotStatus(GridGraph* maze){ // funct
         }
         case s_pathfind: // planned path
         {   
+            if(requestFrontierTarget()){ // RobotMaster finds and reserves closest cell if fs_MasterField is selected
+                robot_status = s_stand_by; // must wait for response
+
+                break;
+            }
+
             // repeat loop until cell which is being planned to has been reserved
             
             bool path_found = BFS_pf2NearestUnknownCell(&planned_path); // create planned path to nearest unknown cell
@@ -139,7 +145,7 @@ void MultiRobot_C_CellReservation::computeRobotStatus(GridGraph* maze){ // funct
         case s_pathfind2target:
         {
             Coordinates target_cell = getTarget2Pathfind();
-            bool path_found = pf_BFS(target_cell.x,target_cell.y);
+            bool path_found = pf_2Target(target_cell.x,target_cell.y);
 
             if(path_found){  
                 requestReserveCell(); // must reserve cell as path found
@@ -1,7 +1,7 @@
 #include "MultiRobot_CellReservation.h"
 
 MultiRobot_CellReservation::MultiRobot_CellReservation(){
-
+    local_search_required = false;
 }
 
 MultiRobot_CellReservation::~MultiRobot_CellReservation(){
@@ -14,67 +14,97 @@ void MultiRobot_CellReservation::requestReserveCell(){
 
     valid_responses.push_back(transaction_counter); // adding transaction to valid responses as response is required
 
-    Message* temp_message = new Message(t_Request, transaction_counter); // generating message
-
     // gathering message data
-    m_reserveCellRequest* message_data = new m_reserveCellRequest;  
+    m_reserveCellRequest message_data;  
+
+    message_data.robot_id = id; // adding id of robot
 
-    message_data->robot_id = id; // adding id of robot
-    message_data->planned_path = planned_path; // adding planned path
+    MessagePayload* payload = Robot_2_Master_Message_Handler->getPayload(Robot_2_Master_Channel);
+    payload->path.assign(planned_path.begin(), planned_path.end()); // adding planned path
 
 
     if(planned_path.size() > 1){ // if more than one element in planned_path, must pass second last element in deque as neigbouring cell
-        message_data->neighbouring_cell = planned_path[planned_path.size() - 2]; // passing second last element in planned_path as neighbouring cell
+        message_data.neighbouring_cell = planned_path[planned_path.size() - 2]; // passing second last element in planned_path as neighbouring cell
     }
     else{ // as planned_path has only 1 element, cell must be neighbouring current position thus pass current position as neighbouring cell
         Coordinates c(x_position,y_position); // gathering current robot coordinates
-        message_data->neighbouring_cell = c; // passing current robot position as neighbouring cell
+        message_data.neighbouring_cell = c; // passing current robot position as neighbouring cell
     }
+    Robot_2_Master_Message_Handler->sendMessage(Message(t_Request, transaction_counter, std::move(message_data), payload, job_epoch), Robot_2_Master_Channel); // sending message to robot master
 
+    return;
+}
 
-    // attaching message data
-    temp_message->msg_data = message_data;
 
-    Robot_2_Master_Message_Handler->sendMessage(temp_message); // sending message to robot master
+bool MultiRobot_CellReservation::requestFrontierTarget(){
 
-    return;
-}
+    if(frontier_search_mode != fs_MasterField || local_search_required){ // robot must search its own LocalMap
+        local_search_required = false; // RobotMaster is asked again on next search
+        return false;
+    }
+
+    transaction_counter++; // incrementing transaction counter as new request is being sent
+
+    valid_responses.push_back(transaction_counter); // adding transaction to valid responses as response is required
 
+    m_getFrontierTargetRequest message_data;
 
+    message_data.robot_id = id; // adding id of robot
+    message_data.current_cell = Coordinates(x_position, y_position); // adding current position
+
+    Robot_2_Master_Message_Handler->sendMessage(Message(t_Request, transaction_counter, std::move(message_data), NULL, job_epoch), Robot_2_Master_Channel); // sending message to robot master
+
+    return true;
+}
 int MultiRobot_CellReservation::handleCellReserveResponse(Message* response, int current_status){
         
     // gathering response type for switch statement
-    m_genericRequest* response_data = (m_genericRequest*) response->msg_data; // use generic message pointer to gather request type
+    int new_robot_status = current_status;
 
-    int new_robot_status;
+    if(std::holds_alternative<m_reserveCellResponse>(response->msg_data)){ // if cell reservation request is being handled
 
-    if(response_data->request_type == reserveCellRequest_ID){ // if cell reservation request is being handled
-
-        m_reserveCellResponse* message_response = (m_reserveCellResponse*)response_data;  // typecasting response data to appropriate format
+        m_reserveCellResponse* message_response = &std::get<m_reserveCellResponse>(response->msg_data); // gathering response data held by message
         
         bool reserved_succeed = message_response->cell_reserved; // gather whether cell has been reserved
 
-        std::vector<Coordinates>* map_info = message_response->map_coordinates; // gather node map for map update
-        std::vector<std::vector<bool>>* edge_info = message_response->map_connections; // gather wall information for each node in map
-        std::vector<char>* map_status = message_response->map_status; // gather status of nodes tracked in returned map
+        const MessagePayload* map = response->Payload; // gather portion of map for map update
 
         if(!reserved_succeed){ // if failed to reserve cell found by pathfinding
                                 
-            if(map_info->size() == 0){ // if a map update is not required (no nodes added to map_info), the target cell if already reserved by another robot
+            if(map->map_coordinates.empty()){ // if a map update is not required (no nodes added to map), the target cell if already reserved by another robot
 
                 already_reserved_cells.push_back(message_response->target_cell); // must add location to already reserved cells to ensure it is not reserved again
             }
             else{
                 // must update map with returned data so next closest cell can be reserved
-                updateLocalMap(map_info, edge_info, map_status);
+                updateLocalMap(map);
             }
 
             new_robot_status = s_pathfind; // change status to pathfind as must try and reserve different with updated map info
         }
         else{  // if cell reserved
             already_reserved_cells.clear(); // can clear already reserved cells 
+            resetFrontierSearch(); // previously rejected cells may now be valid targets
+            new_robot_status = s_move_robot; // setting status to 3 so movement will occur on next loop cycle
+        }
+    }
+    else if(std::holds_alternative<m_getFrontierTargetResponse>(response->msg_data)){ // if RobotMaster has searched for a cell on robot's behalf
+
+        m_getFrontierTargetResponse* message_response = &std::get<m_getFrontierTargetResponse>(response->msg_data); // gathering response data held by message
+
+        if(message_response->target_found){ // cell has been reserved
+            updateLocalMap(response->Payload); // adding cells along path to LocalMap so path can be followed
+            
+            planned_path.assign(response->Payload->path.begin(), response->Payload->path.end());
+
+            already_reserved_cells.clear(); // can clear already reserved cells 
+            resetFrontierSearch(); // previously rejected cells may now be valid targets
             new_robot_status = s_move_robot; // setting status to 3 so movement will occur on next loop cycle
         }
+        else{ // no unreserved cell can be reached on GlobalMap
+            local_search_required = true; // searching LocalMap as robot may still find a reserved cell it is closer to
+            new_robot_status = s_pathfind;
+        }
     }
     else{ // do nothing if other request type is sent
         new_robot_status = current_status;
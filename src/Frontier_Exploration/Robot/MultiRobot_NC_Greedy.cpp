@@ -95,6 +95,11 @@ void MultiRobot_NC_CellReservation::computeRobotStatus(GridGraph* maze){
         }
         case s_pathfind: // planned path
         {   
+            if(requestFrontierTarget()){ // RobotMaster finds and reserves closest cell if fs_MasterField is selected
+                robot_status = s_stand_by; // must wait for response
+
+                break;
+            }
 
             // repeat loop until cell which is being planned to has been reserved
             
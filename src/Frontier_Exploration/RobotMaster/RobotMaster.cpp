@@ -9,22 +9,30 @@ RobotMaster::RobotMaster(RequestHandler* r, int num_of_robots, unsigned int xsiz
 
     GlobalMap = new GridGraph(maze_xsize, maze_ysize); // allocating GlobalMap to maze size
     
-    for(int i = 0; i < GlobalMap->x_edges.size(); i++) // placing wall in every cell location as they are unknown
-        for(int j = 0; j < GlobalMap->x_edges[i].size(); j++)
-            GlobalMap->x_edges[i][j] = true;
+    GlobalMap->setAllEdges(true); // placing wall in every cell location as they are unknown
 
-    for(int i = 0; i < GlobalMap->y_edges.size(); i++) // placing wall in every cell location as they are unknown
-        for(int j = 0; j < GlobalMap->y_edges[i].size(); j++)
-            GlobalMap->y_edges[i][j] = true;
+    Workspace = PathfindingWorkspace(maze_xsize, maze_ysize); // allocating pathfinding workspace to maze size
+
+    Planner = createPathPlanner(pp_AStar); // targets are known so A* is used by default
+
+    Oracle = NULL; // distance oracle is only maintained once enabled
+    Frontiers = NULL; // frontier distance field is only maintained once enabled
 
     num_of_receieve_transactions = 0; // no transactions recieved yet
+    num_of_map_changes = 0; // GlobalMap has not been changed
+    trace_requests = true;
     number_of_frontier_cells = 0; // no cells have been explored
 
     num_of_added_robots = 0; // no robots have been added
+
+    cell_occupants.resize(maze_xsize*maze_ysize); // all cells are empty until robots are added
 }
 
 RobotMaster::~RobotMaster(){
     delete GlobalMap; // deallocating GlobalMap
+    delete Planner;
+    delete Oracle;
+    delete Frontiers;
 }
 
 void RobotMaster::runRobotMaster(){ // function to continously run RobotMaster until the maze has been mapped
@@ -48,36 +56,17 @@ void RobotMaster::robotMasterSetUp(){
 
 bool RobotMaster::receiveRequests(){ // function to handle incoming requests from robots
     
-    Message* request = Message_Handler->getMessage(); // gathering request from msg_queue
-                                                      // pointer is gathered so response can be gathered by robot threads
-                                                      // returned pointer will be NULL is no messages to get
-
-    if(request != NULL){ // if there is a a request to handle, process it
-
-        // gathering request type for switch statement
-        num_of_receieve_transactions++; // get next request id for request tracking purposes
+    Message request; // request is moved out of its channel into this message
+    
+    if(Message_Handler->getMessage(&request)){ // if there is a a request to handle, process it
 
-        if(accepting_requests){
-            // processing incoming request
-            handleIncomingRequest(request);
-            
+        if(handleRequest(&request)){ // if all robots have successfully shut down
+            return true; // maze exploration done
         }
-        else if(!accepting_requests && request->msg_data->request_type == shutDownRequest_ID){ // shutDown confirmation request ( robot is telling master that it is shutting down)
-
-            shutDownRequest(request);
 
-            if(tracked_robots.size() == 0){ // if all robots have successfully shut down
-                return true; // maze exploration done
-            }
-        }
-        else{
-            // not accepting requests but not a shut down request
-            // thus do nothing
+        if(accepting_requests && Message_Handler->getNumberofMessages() == 0){ // if all requests sent so far have been handled
+            handleQueuedRequests();
         }
-
-        // request processed thus can delete data
-        delete request->msg_data; // deleting dynamically allocated message data
-        delete request; // delete dynamically allocated request
     }
     else{ // if no message to handle, do nothing
 
@@ -86,12 +75,59 @@ bool RobotMaster::receiveRequests(){ // function to handle incoming requests fro
     return false; // return false as maze is not completely mapped
 }
 
-RequestHandler* RobotMaster::getTargetRequestHandler(unsigned int target_id){ // gets a request handler for a specific robot
-    for(int i = 0; i < tracked_robots.size(); i++){
-        if(tracked_robots[i].robot_id == target_id){
-            return tracked_robots[i].Robot_Message_Reciever; // return requesthandler for targer robot
+bool RobotMaster::receiveAllRequests(unsigned int turn){ // handles every request sent so far as one batch
+
+    Message_Handler->drainAll(&request_batch, turn); // taking every request out of the queue at once
+
+    bool maze_mapped = false;
+
+    for(int i = 0; i < request_batch.size(); i++){
+        if(handleRequest(&request_batch[i])){
+            maze_mapped = true; // all robots have shut down, no further requests will be sent
         }
     }
+
+    if(accepting_requests && !request_batch.empty()){ // every request of batch has been handled
+        handleQueuedRequests();
+    }
+
+    request_batch.clear(); // capacity is kept for next batch
+
+    return maze_mapped;
+}
+
+bool RobotMaster::handleRequest(Message* request){ // handles a single request, returns true once all robots have shut down
+
+    // gathering request type for switch statement
+    num_of_receieve_transactions++; // get next request id for request tracking purposes
+
+    if(accepting_requests){
+        // processing incoming request
+        handleIncomingRequest(request);
+        
+    }
+    else if(!accepting_requests && std::holds_alternative<m_shutDownRequest>(request->msg_data)){ // shutDown confirmation request ( robot is telling master that it is shutting down)
+
+        shutDownRequest(request);
+
+        if(tracked_robots.size() == 0){ // if all robots have successfully shut down
+            return true; // maze exploration done
+        }
+    }
+    else{
+        // not accepting requests but not a shut down request
+        // thus do nothing
+    }
+
+    return false;
+}
+
+RequestHandler* RobotMaster::getTargetRequestHandler(unsigned int target_id){ // gets a request handler for a specific robot
+    RobotInfo* robot_info = getRobotInfo(target_id);
+
+    if(robot_info != NULL){
+        return robot_info->Robot_Message_Reciever; // return requesthandler for targer robot
+    }
     
     return NULL; // if not found, return NULL
 }
@@ -103,30 +139,22 @@ void RobotMaster::shutDownRequest(Message* request){ // disconnects robot from s
     // no return data
 
     // gathering data from request
-    m_shutDownRequest* request_data = (m_shutDownRequest*)request->msg_data; // first pointer of msg_data points to robot id
+    m_shutDownRequest* request_data = &std::get<m_shutDownRequest>(request->msg_data);
     
 
     // gathering response data
-    m_shutDownResponse* response_data = new m_shutDownResponse;
+    Message response(t_Response, request->transaction_id, m_shutDownResponse()); // creating new response with given response id      
 
-    // sending response message to robot
-    Message* response = new Message(t_Response, request->transaction_id); // creating new response with given response id      
-    response->msg_data = response_data; // assigning response to message
+    exportRequestInfo2Trace(request->msg_data, NULL, &response.msg_data, NULL, num_of_receieve_transactions);
 
     RequestHandler* robot_request_handler = getTargetRequestHandler(request_data->robot_id); // getting request handler to send response
 
     if (robot_request_handler != NULL){ // if request handler gathered send data
-        robot_request_handler->sendMessage(response);
+        robot_request_handler->sendMessage(std::move(response));
 
         // shut down request has been fully handled, can remove robot from system
         removeRobot(request_data->robot_id); 
     }
-    else{ // if no request handler found, must delete response data and not send message
-        delete response_data;
-        delete response;
-    }
-
-    exportRequestInfo2JSON(request_data, response_data, num_of_receieve_transactions);
 
     return;
 }
@@ -141,7 +169,7 @@ void RobotMaster::addRobotRequest(Message* request){ // adds robot to master sys
     // [0] = type: (unsigned int*), content: id to be assigned to robot
 
     // gathering incoming request
-    m_addRobotRequest* request_data = (m_addRobotRequest*)request->msg_data;
+    m_addRobotRequest* request_data = &std::get<m_addRobotRequest>(request->msg_data);
     
     // processing request data
     unsigned int x = request_data->x;
@@ -152,17 +180,15 @@ void RobotMaster::addRobotRequest(Message* request){ // adds robot to master sys
                                                                   // return value is assigned id of robot
 
     // gathering response data
-    m_addRobotResponse* response_data = new m_addRobotResponse;
-    response_data->robot_id = robot_id;
-
-    exportRequestInfo2JSON(request_data, response_data, num_of_receieve_transactions); // adding request info to tracking JSON
+    m_addRobotResponse response_data;
+    response_data.robot_id = robot_id;
     
     // sending response message to robot
-    Message* response = new Message(t_Response, request->transaction_id); // creating new response with given response id
-        
-    response->msg_data = response_data; // assigning response to message
+    Message response(t_Response, request->transaction_id, response_data); // creating new response with given response id
+
+    exportRequestInfo2Trace(request->msg_data, NULL, &response.msg_data, NULL, num_of_receieve_transactions); // adding request info to request trace
 
-    robot_request_handler->sendMessage(response);
+    robot_request_handler->sendMessage(std::move(response));
 
     return;
 }
@@ -170,7 +196,7 @@ void RobotMaster::addRobotRequest(Message* request){ // adds robot to master sys
 void RobotMaster::updateGlobalMapRequest(Message* request){
     // updateGlobalMap request msg_data layout:
     // [0] = type: (unsigned int*), content: id of robot sending request
-    // [1] = type: (vector<bool>*), content: vector containing information on walls surrounding robot
+    // [1] = type: (bool[4]), content: information on walls surrounding robot
             // [0] = north, [1] = south, [2] = east, [3] = west
             // 0 = connection, 1 = wall
     // [2] = type: (Coordinates*), content: current coordinates of where the read occured
@@ -178,15 +204,14 @@ void RobotMaster::updateGlobalMapRequest(Message* request){
     // return data = none
 
     // gathering incoming request data
-    m_updateGlobalMapRequest* request_data = (m_updateGlobalMapRequest*)request->msg_data;
+    m_updateGlobalMapRequest* request_data = &std::get<m_updateGlobalMapRequest>(request->msg_data);
 
     unsigned int robot_id = request_data->robot_id;
-    std::vector<bool> wall_info = request_data->wall_info;
     Coordinates cords = request_data->cords; // gathering position of scanned reading
 
-    updateGlobalMap(&robot_id, &wall_info, &cords); // updating global map with information
+    updateGlobalMap(&robot_id, request_data->wall_info, &cords); // updating global map with information
 
-    exportRequestInfo2JSON(request_data, NULL, num_of_receieve_transactions); // adding request info to tracking JSON
+    exportRequestInfo2Trace(request->msg_data, NULL, NULL, NULL, num_of_receieve_transactions); // adding request info to request trace
 
     return;
 }
@@ -199,13 +224,13 @@ void RobotMaster::updateRobotLocationRequest(Message* request){
     // no return data
 
     // gathering incoming request data
-    m_updateRobotLocationRequest* request_data = (m_updateRobotLocationRequest*)request->msg_data; 
+    m_updateRobotLocationRequest* request_data = &std::get<m_updateRobotLocationRequest>(request->msg_data);
     unsigned int robot_id = request_data->robot_id;
     Coordinates new_robot_location = request_data->new_robot_location;
 
     updateRobotLocation(&robot_id, &new_robot_location); // updating robot location
 
-    exportRequestInfo2JSON(request_data, NULL, num_of_receieve_transactions); // adding request info to tracking JSON
+    exportRequestInfo2Trace(request->msg_data, NULL, NULL, NULL, num_of_receieve_transactions); // adding request info to request trace
 
     return;
 }
@@ -214,30 +239,55 @@ unsigned int RobotMaster::addRobot(unsigned int x, unsigned int y, RequestHandle
                                                                                        // this must be completed by all robots before beginning exploration
     num_of_added_robots++; // incrementing inorder to determine next id to give a robot
 
-    RobotInfo temp; // buffer to store robot info before pushing it to the tracked_robots vecto
+    robot_slots.emplace_back(); // ids are given out in order so robot's slot is always the next one
+    RobotInfo* temp = &robot_slots.back(); // robot info is filled in place as its address must not change
 
-    temp.robot_id = num_of_added_robots; // assigning id to new robot entry 
-    temp.robot_position.x = x;  // assigning position to new robot entry 
-    temp.robot_position.y = y;
-    temp.starting_position = temp.robot_position; // assigning starting position to robot
-    temp.robot_moving = false; // initializing robot_moving flag to false as robot has not begun moving
-    temp.robot_target = NULL_COORDINATE;  // setting target to an invalid coordinate as robots have not begun exploring
+    temp->robot_id = num_of_added_robots; // assigning id to new robot entry 
+    temp->robot_position = NULL_COORDINATE; // robot is placed in its cell below
+    temp->starting_position = Coordinates(x, y); // assigning starting position to robot
+    temp->robot_moving = false; // initializing robot_moving flag to false as robot has not begun moving
+    temp->robot_target = NULL_COORDINATE;  // setting target to an invalid coordinate as robots have not begun exploring
+    temp->job_epoch = 0; // robot has not been given a target by master
 
-    temp.Robot_Message_Reciever = r; // assigning Request handler for Master -> robot communications
+    temp->Robot_Message_Reciever = r; // assigning Request handler for Master -> robot communications
 
-    if(GlobalMap->nodes[y][x] != 2){ // if the cell has not been marked as seen (e.g. another robot hasnt already been placed in the cell)
-        GlobalMap->nodes[y][x] = 2; // setting current position of robot to 2 as it has been seen but not explored until robot sends first scan update
+    setRobotPosition(temp, temp->starting_position); // assigning position to new robot entry
+
+    if(GlobalMap->getNode(x, y) != 2){ // if the cell has not been marked as seen (e.g. another robot hasnt already been placed in the cell)
+        GlobalMap->setNode(x, y, 2); // setting current position of robot to 2 as it has been seen but not explored until robot sends first scan update
+        globalMapCellChanged(x, y);
         number_of_frontier_cells++; // incrementing number of unexplored by 1 as current robot cells has presumably not been explored
     }
 
+    if(Oracle != NULL){
+        Oracle->addCell(temp->robot_position); // starting cell is known before any of its connections
+    }
+
     tracked_robots.push_back(temp); // adding robot info to tracked_robots
+    robot_lookup.push_back(temp);
 
-    return temp.robot_id; // returning id to be assigned to the robot which triggered this function
+    return temp->robot_id; // returning id to be assigned to the robot which triggered this function
 }
 
 void RobotMaster::removeRobot(unsigned int id){
-    for(int i = 0; i < tracked_robots.size(); i++){ // search for robot in tracked_robots
-        if(tracked_robots[i].robot_id == id){ // if robot has been identified
+    RobotInfo* robot_info = getRobotInfo(id);
+
+    if(robot_info == NULL){ // robot is not tracked
+        return;
+    }
+
+    // removing robot from cell lookups, position and target are kept in RobotInfo
+    Coordinates position = robot_info->robot_position;
+    Coordinates target = robot_info->robot_target;
+    setRobotPosition(robot_info, NULL_COORDINATE);
+    setRobotTarget(robot_info, NULL_COORDINATE);
+    robot_info->robot_position = position;
+    robot_info->robot_target = target;
+
+    robot_lookup[id - 1] = NULL;
+
+    for(int i = 0; i < tracked_robots.size(); i++){ // search for robot in tracked_robots, this only occurs once per robot
+        if(tracked_robots[i] == robot_info){ // if robot has been identified
             tracked_robots.erase(tracked_robots.begin()+i); // delete it from tracked_robots
             break;
         }
@@ -246,44 +296,57 @@ void RobotMaster::removeRobot(unsigned int id){
     return;
 }
 
-void RobotMaster::updateGlobalMap(unsigned int* id, std::vector<bool>* connections, Coordinates* C){
+void RobotMaster::updateGlobalMap(unsigned int*, const bool* connections, Coordinates* C){
 
 
-    if (GlobalMap->nodes[C->y][C->x] != 1){ // checking if there is a need to update map (has the current node been explored?)
+    if (GlobalMap->getNode(C->x, C->y) != 1){ // checking if there is a need to update map (has the current node been explored?)
         
         number_of_frontier_cells--; // subtracting number of unexplored cells as new cell has been explored
 
         // updating vertical edges in GlobalMap using robot reading
-        GlobalMap->y_edges[C->y][C->x] = (*connections)[0]; // north
-        GlobalMap->y_edges[C->y + 1][C->x] = (*connections)[1]; // south
+        GlobalMap->setYEdge(C->x, C->y, connections[0]); // north
+        GlobalMap->setYEdge(C->x, C->y + 1, connections[1]); // south
 
-        GlobalMap->x_edges[C->y][C->x] = (*connections)[2]; // east
-        GlobalMap->x_edges[C->y][C->x + 1] = (*connections)[3]; // west
+        GlobalMap->setXEdge(C->x, C->y, connections[2]); // east
+        GlobalMap->setXEdge(C->x + 1, C->y, connections[3]); // west
 
-        GlobalMap->nodes[C->y][C->x] = 1; // updating state of node to be 1 as it has been explored
+        GlobalMap->setNode(C->x, C->y, 1); // updating state of node to be 1 as it has been explored
+        globalMapCellChanged(C->x, C->y);
 
         // now we will update the neighbouring cells to see if they have previously been explored
         // if not, they will be marked with a '2' on the GlobalMap Nodes Array
 
-        if(!GlobalMap->y_edges[C->y][C->x] && GlobalMap->nodes[C->y - 1][C->x] == 0){ // checking if node to north hasn't been explored by a Robot
-            GlobalMap->nodes[C->y - 1][C->x] = 2; // if unexplored and no wall between robot and cell, set northern node to unexplored
+        if(!GlobalMap->getYEdge(C->x, C->y) && GlobalMap->getNode(C->x, C->y - 1) == 0){ // checking if node to north hasn't been explored by a Robot
+            GlobalMap->setNode(C->x, C->y - 1, 2); // if unexplored and no wall between robot and cell, set northern node to unexplored
+            globalMapCellChanged(C->x, C->y - 1);
             number_of_frontier_cells++; // incrementing number of unexplored nodes by 1 as this neighbouring node has not been explored
         }
         // checking south
-        if(!GlobalMap->y_edges[C->y + 1][C->x] && GlobalMap->nodes[C->y + 1][C->x] == 0){ // checking if node to north hasn't been explored by a Robot
-            GlobalMap->nodes[C->y + 1][C->x] = 2; // if unexplored and no wall between robot and cell, set southern node to unexplored
+        if(!GlobalMap->getYEdge(C->x, C->y + 1) && GlobalMap->getNode(C->x, C->y + 1) == 0){ // checking if node to north hasn't been explored by a Robot
+            GlobalMap->setNode(C->x, C->y + 1, 2); // if unexplored and no wall between robot and cell, set southern node to unexplored
+            globalMapCellChanged(C->x, C->y + 1);
             number_of_frontier_cells++; // incrementing number of unexplored nodes by 1 as this neighbouring node has not been explored
         }
         // checking east
-        if(!GlobalMap->x_edges[C->y][C->x] && GlobalMap->nodes[C->y][C->x - 1] == 0){ // checking if node to north hasn't been explored by a Robot
-            GlobalMap->nodes[C->y][C->x - 1] = 2; // if unexplored and no wall between robot and cell, set eastern node to unexplored
+        if(!GlobalMap->getXEdge(C->x, C->y) && GlobalMap->getNode(C->x - 1, C->y) == 0){ // checking if node to north hasn't been explored by a Robot
+            GlobalMap->setNode(C->x - 1, C->y, 2); // if unexplored and no wall between robot and cell, set eastern node to unexplored
+            globalMapCellChanged(C->x - 1, C->y);
             number_of_frontier_cells++; // incrementing number of unexplored nodes by 1 as this neighbouring node has not been explored
         }
         // checking west
-        if(!GlobalMap->x_edges[C->y][C->x + 1] && GlobalMap->nodes[C->y][C->x + 1] == 0){ // checking if node to north hasn't been explored by a Robot
-            GlobalMap->nodes[C->y][C->x + 1] = 2; // if unexplored and no wall between robot and cell, set western node to unexplored
+        if(!GlobalMap->getXEdge(C->x + 1, C->y) && GlobalMap->getNode(C->x + 1, C->y) == 0){ // checking if node to north hasn't been explored by a Robot
+            GlobalMap->setNode(C->x + 1, C->y, 2); // if unexplored and no wall between robot and cell, set western node to unexplored
+            globalMapCellChanged(C->x + 1, C->y);
             number_of_frontier_cells++; // incrementing number of unexplored nodes by 1 as this neighbouring node has not been explored
         }
+
+        if(Oracle != NULL){ // passing open connections of explored cell to distance oracle
+            std::vector<Coordinates> neighbours = getSeenNeighbours(C->x, C->y); // every cell behind an open wall has now been seen
+
+            for(int i = 0; i < neighbours.size(); i++){
+                Oracle->addConnection(*C, neighbours[i]);
+            }
+        }
     }
     else{ // if there is no need to update map
 
@@ -294,16 +357,55 @@ void RobotMaster::updateGlobalMap(unsigned int* id, std::vector<bool>* connectio
     return;
 }
 
-std::vector<bool> RobotMaster::getNodeEdgeInfo(Coordinates* C){
+int RobotMaster::getKnownDistance(Coordinates a, Coordinates b){ // length of shortest path between cells on GlobalMap
+
+    if(Oracle != NULL && Oracle->isTree()){ // tree distance is exact while GlobalMap contains no cycles
+        int distance = Oracle->getDistance(a, b);
+
+        if(distance >= 0){
+            return distance;
+        }
+    }
+
+    // falling back to searching GlobalMap
+    bool path_found = Planner->planPath(&Workspace, a, b, [this](int x, int y){ return getSeenNeighbours(x, y); });
+
+    if(!path_found){
+        return -1;
+    }
+
+    int distance = 0;
+    int start_index = Workspace.toIndex(a);
+
+    for(int curr_index = Workspace.toIndex(b); curr_index != start_index; curr_index = Workspace.getParent(curr_index)){ // counting cells along path
+        distance++;
+    }
+
+    return distance;
+}
+
+void RobotMaster::globalMapCellChanged(int x, int y){ // must be called after every change to GlobalMap
+    num_of_map_changes++;
+
+    if(Frontiers != NULL){
+        Frontiers->cellChanged(x, y);
+    }
+
+    return;
+}
+
+void RobotMaster::addMapCell(Coordinates C, MessagePayload* map){
     
-    std::vector<bool> edge_info; // vector to return with information on edges surrounding node C
+    map->map_coordinates.push_back(C); // node coordinates
+
+    map->map_walls.push_back(GlobalMap->getYEdge(C.x, C.y));    // north edge
+    map->map_walls.push_back(GlobalMap->getYEdge(C.x, C.y + 1));// south edge
+    map->map_walls.push_back(GlobalMap->getXEdge(C.x, C.y));    // east edge
+    map->map_walls.push_back(GlobalMap->getXEdge(C.x + 1, C.y));// west edge
 
-    edge_info.push_back(GlobalMap->y_edges[C->y][C->x]);    // [0] = north edge
-    edge_info.push_back(GlobalMap->y_edges[C->y + 1][C->x]);// [1] = south edge
-    edge_info.push_back(GlobalMap->x_edges[C->y][C->x]);    // [2] = east edge
-    edge_info.push_back(GlobalMap->x_edges[C->y][C->x + 1]);// [3] = west edge
+    map->map_status.push_back(GlobalMap->getNode(C.x, C.y)); // node status
 
-    return edge_info;
+    return;
 }
 
 std::vector<Coordinates> RobotMaster::getSeenNeighbours(unsigned int x, unsigned  int y){ // function to gather seen neighbouring cells of a selected cell based on global map
@@ -315,7 +417,7 @@ std::vector<Coordinates> RobotMaster::getSeenNeighbours(unsigned int x, unsigned
 
     // check if neighbour to the north is valid and connected via an edge (no wall)
     if(y != 0){ // protection to ensure invalid part of nodes is not accessed if y = 0
-        if(!GlobalMap->y_edges[y][x] && GlobalMap->nodes[y-1][x] > 0){
+        if(!GlobalMap->getYEdge(x, y) && GlobalMap->getNode(x, y-1) > 0){
             buffer.x = x; 
             buffer.y = y - 1;
             ret_value.push_back(buffer);
@@ -323,7 +425,7 @@ std::vector<Coordinates> RobotMaster::getSeenNeighbours(unsigned int x, unsigned
     }
     // check if neighbour to the south is valid and connected via an edge (no wall)
     if(y != maze_ysize - 1){
-        if(!GlobalMap->y_edges[y+1][x] && GlobalMap->nodes[y+1][x] > 0){
+        if(!GlobalMap->getYEdge(x, y+1) && GlobalMap->getNode(x, y+1) > 0){
             buffer.x = x; 
             buffer.y = y + 1;
             ret_value.push_back(buffer);
@@ -331,7 +433,7 @@ std::vector<Coordinates> RobotMaster::getSeenNeighbours(unsigned int x, unsigned
     }
     // check if neighbour to the east is valid and connected via an edge (no wall)
     if(x != 0){ // protection to ensure invalid part of nodes is not accessed if x = 0
-        if(!GlobalMap->x_edges[y][x] && GlobalMap->nodes[y][x-1] > 0){
+        if(!GlobalMap->getXEdge(x, y) && GlobalMap->getNode(x-1, y) > 0){
             buffer.x = x - 1; 
             buffer.y = y;
             ret_value.push_back(buffer);
@@ -339,7 +441,7 @@ std::vector<Coordinates> RobotMaster::getSeenNeighbours(unsigned int x, unsigned
     }
     // check if neighbour to the west is valid and connected via an edge (no wall)
     if(x != maze_xsize - 1){
-        if(!GlobalMap->x_edges[y][x+1] && GlobalMap->nodes[y][x+1] > 0){
+        if(!GlobalMap->getXEdge(x+1, y) && GlobalMap->getNode(x+1, y) > 0){
             buffer.x = x + 1; 
             buffer.y = y;
             ret_value.push_back(buffer);
@@ -348,75 +450,65 @@ std::vector<Coordinates> RobotMaster::getSeenNeighbours(unsigned int x, unsigned
     return ret_value; // returning vector
 }
 
-void RobotMaster::gatherPortionofMap(Coordinates curr_node, Coordinates neighbour_node, std::vector<Coordinates>* map_nodes, std::vector<std::vector<bool>>* map_connections, std::vector<char>* node_status){ // generates a portion of the map for transfer to robot using breadth first search
+void RobotMaster::gatherPortionofMap(Coordinates curr_node, Coordinates neighbour_node, MessagePayload* map){ // generates a portion of the map for transfer to robot using breadth first search
+
+    Workspace.beginSearch(); // invalidating visited nodes and queue of any previous search
 
-    std::queue<Coordinates> node_queue; // creating node queue to store nodes to be "explored" by algorithm
+    int start_index = Workspace.toIndex(curr_node);
 
-    node_queue.push(curr_node); // adding first node to explore to node queue
+    Workspace.push(start_index); // adding first node to explore to node queue
+    Workspace.visit(start_index, start_index); // marking first node as visited using itself as parent
     
-    // gathering starting cell info for return
-    map_nodes->push_back(curr_node); // node coordinates
-    map_connections->push_back(getNodeEdgeInfo(&curr_node)); // node connections
-    node_status->push_back(GlobalMap->nodes[curr_node.y][curr_node.x]); // node status
+    addMapCell(curr_node, map); // gathering starting cell info for return
 
-    while(node_queue.size() != 0){// while nodes to explore are in node_queue
+    while(!Workspace.queueEmpty()){// while nodes to explore are in node_queue
         
-        curr_node = node_queue.front(); // gathering node from front of queue
+        int curr_index = Workspace.front(); // gathering node from front of queue
+        curr_node = Workspace.toCoordinates(curr_index);
 
-        node_queue.pop(); // removing node from front of the queue as new nodes must be added to queue
+        Workspace.pop(); // removing node from front of the queue as new nodes must be added to queue
 
         std::vector<Coordinates> valid_neighbours = getSeenNeighbours(curr_node.x, curr_node.y); // gathering neighbours of current node
 
         for(int i = 0; i < valid_neighbours.size(); i++){ // iterate through all of the current node's neighbours to see if they have been explored
             
-            bool already_visited = false;
+            int neighbour_index = Workspace.toIndex(valid_neighbours[i]);
 
-            for(int j = 0; j < map_nodes->size(); j++){ // checking to see if the current node has already been visited
-                if(valid_neighbours[i] == (*map_nodes)[j]){
-                    already_visited = true;
-                    break;
-                }
-            }
-
-            if(!already_visited && valid_neighbours[i] != neighbour_node){ // if it hasnt been visited and is not down the path the robot came from, add it to map connections to send back to robot
-                node_queue.push(valid_neighbours[i]); // add node to explore down during next iteration of the loop
+            if(!Workspace.isVisited(neighbour_index) && valid_neighbours[i] != neighbour_node){ // if it hasnt been visited and is not down the path the robot came from, add it to map connections to send back to robot
+                Workspace.push(neighbour_index); // add node to explore down during next iteration of the loop
+                Workspace.visit(neighbour_index, curr_index);
 
-                map_nodes->push_back(valid_neighbours[i]); // node coordinates
-                map_connections->push_back(getNodeEdgeInfo(&valid_neighbours[i])); // node connections
-                node_status->push_back(GlobalMap->nodes[valid_neighbours[i].y][valid_neighbours[i].x]); // node status
+                addMapCell(valid_neighbours[i], map); // gathering node info for return
             }
         }
     }
 
-    return; // can return as map information loaded into various vectors
+    return; // can return as map information loaded into payload
 }
 
 bool RobotMaster::checkIfOccupied(unsigned int x, unsigned int y, unsigned int* ret_variable){ // checks if a robot is within the cell passed into the function
                                                                                                // returns true is a robot is detected
                                                                                                // if a robot is found, ret_variable is modified to contain the id of the found robot
-    unsigned int temp = 0;
-    for(int i = 0; i < tracked_robots.size(); i++){ // looping through robots position
-        if(tracked_robots[i].robot_position.x == x && tracked_robots[i].robot_position.y == y){ // if robot is occupying the location passed in
-            temp = tracked_robots[i].robot_id; // returning found robot id
-            *ret_variable = temp;
+    RobotInfo* occupying_robot = getRobotInCell(Coordinates(x, y));
 
-            return true; // return true as robot is occupying the cell
-        }
+    if(occupying_robot != NULL){ // if robot is occupying the location passed in
+        *ret_variable = occupying_robot->robot_id; // returning found robot id
+
+        return true; // return true as robot is occupying the cell
     }
+
     return false; // returning false as robot is not found within the occupied cell
 }
 
 void RobotMaster::updateRobotLocation(unsigned int* id, Coordinates* C){ // updates the location of a robot to the location specified
 
-    for(int i = 0; i < tracked_robots.size(); i++){ // finding robot to update
-        if (tracked_robots[i].robot_id == *id){ // if robot found using id
-            tracked_robots[i].robot_position = *C; // update position in RobotInfo
-            tracked_robots[i].robot_moving = false; // setting robot_moving flag to false as robot is done moving
-            if(tracked_robots[i].planned_path.size() > 0)
-                tracked_robots[i].planned_path.pop_front(); // remove front of planned_path as movement has occured
-            
-            break; 
-        }
+    RobotInfo* robot_info = getRobotInfo(*id); // finding robot to update
+
+    if(robot_info != NULL){ // if robot found using id
+        setRobotPosition(robot_info, *C); // update position in RobotInfo
+        robot_info->robot_moving = false; // setting robot_moving flag to false as robot is done moving
+        if(robot_info->planned_path.size() > 0)
+            robot_info->planned_path.pop_front(); // remove front of planned_path as movement has occured
     }
 
     return;
@@ -426,7 +518,7 @@ void RobotMaster::updateAllRobotState(int status){
 
     for(int i = 0; i < tracked_robots.size(); i++){ // creating messages to update state of all robots
         
-        updateRobotState(status, tracked_robots[i].Robot_Message_Reciever);
+        updateRobotState(status, tracked_robots[i]->Robot_Message_Reciever);
     }
 
     return;    
@@ -434,219 +526,15 @@ void RobotMaster::updateAllRobotState(int status){
 
 void RobotMaster::updateRobotState(int status, RequestHandler* Target_Robot_Receiver){
 
-    Message* messages = new Message(t_Request, -1); // creating new messages for each robot
-
     // assigning data to message
-    m_updateRobotStateRequest* message_data = new m_updateRobotStateRequest;
-    message_data->target_state = status;
-
-    messages->msg_data = message_data; // specifying state to update all robots to
+    m_updateRobotStateRequest message_data;
+    message_data.target_state = status; // specifying state to update all robots to
     
-    Target_Robot_Receiver->sendMessage(messages); // sending message
+    Target_Robot_Receiver->sendMessage(Message(t_Request, -1, message_data)); // sending message
 
     return;
 }
 
-void RobotMaster::exportRequestInfo2JSON(m_genericRequest* request, m_genericRequest* response, unsigned int transaction_id){
-    // creating jsons
-    json request_buffer_json, response_buffer_json; // buffer jsons to store request and response information 
-
-    switch(request->request_type){ // switch to determine which type of request has been received
-                                   // this is required inorder to typecast and export the appropriate information
-        case shutDownRequest_ID:
-        {
-            // typecast to appropriate child class to gather request data
-            m_shutDownRequest* request_cast = (m_shutDownRequest*) request;
-            
-            // adding request infomation to buffer json
-            request_buffer_json["ID"] = request_cast->robot_id;
-
-            break;
-        }
-        case addRobotRequest_ID:
-        {
-            // typecast to appropriate child class to gather request data
-            m_addRobotRequest* request_cast = (m_addRobotRequest*) request;
-            
-            // adding request infomation to buffer json
-            request_buffer_json["x_pos"] = request_cast->x;
-            request_buffer_json["y_pos"] = request_cast->y;
-
-            break;
-        }
-        case updateGlobalMapRequest_ID:
-        {
-            // typecast to appropriate child class to gather request data
-            m_updateGlobalMapRequest* request_cast = (m_updateGlobalMapRequest*) request;
-            
-            // adding request infomation to buffer json
-            request_buffer_json["ID"] = request_cast->robot_id;
-
-            request_buffer_json["Current_Cell"] = { {"x_pos", request_cast->cords.x},
-                                                    {"y_pos", request_cast->cords.y} };
-
-            // json.hpp does not allow for bool to be placed into json therefore must convert to other datatype
-            // initialize all walls to no as they have not be checked
-            std::string wall_north = "n"; 
-            std::string wall_south = "n"; 
-            std::string wall_east = "n";
-            std::string wall_west = "n";
-
-            if(request_cast->wall_info[0]) // if there is a wall to the north
-                wall_north = "y"; // set wall_north to y for yes
-            
-            if(request_cast->wall_info[1]) // if there is a wall to the south
-                wall_south = "y"; // set wall_north to y for yes
-            
-            if(request_cast->wall_info[2]) // if there is a wall to the east
-                wall_east = "y"; // set wall_north to y for yes
-
-            if(request_cast->wall_info[3]) // if there is a wall to the west
-                wall_west = "y"; // set wall_north to y for yes
-
-            // adding wall info to buffer json
-            request_buffer_json["Wall_Info"] = { {"North", wall_north},
-                                                 {"South", wall_south},
-                                                 {"East", wall_east},
-                                                 {"West", wall_west} };
-            break;
-        }
-        case move2CellRequest_ID:
-        {
-            // typecast to appropriate child class to gather request data
-            m_move2CellRequest* request_cast = (m_move2CellRequest*) request;
-            
-            // adding request infomation to buffer json
-            request_buffer_json["ID"] = request_cast->robot_id;
-
-            request_buffer_json["Target_Cell"] = { { "x_pos", request_cast->target_cell.x},
-                                                   { "y_pos", request_cast->target_cell.y} };
-            break;
-        }
-        case reserveCellRequest_ID:
-        {
-             // typecast to appropriate child class to gather request data
-            m_reserveCellRequest* request_cast = (m_reserveCellRequest*) request;
-            
-            // adding request infomation to buffer json
-            request_buffer_json["ID"] = request_cast->robot_id;
-
-            for(int i = 0; i < request_cast->planned_path.size(); i++){
-                request_buffer_json["Target_Cell"].push_back({ request_cast->planned_path[i].x, request_cast->planned_path[i].y });
-            }
-            
-            break;
-        }
-        case updateRobotLocationRequest_ID:
-        {
-             // typecast to appropriate child class to gather request data
-            m_updateRobotLocationRequest* request_cast = (m_updateRobotLocationRequest*) request;
-            
-            // adding request infomation to buffer json
-            request_buffer_json["ID"] = request_cast->robot_id;
-
-            request_buffer_json["Current_Cell"] = { { "x_pos", request_cast->new_robot_location.x},
-                                                    { "y_pos", request_cast->new_robot_location.y} };
-            break;
-        }
-        case getMapRequest_ID:
-        {
-            // typecast to appropriate child class to gather response data
-            m_getMapRequest* request_cast = (m_getMapRequest*) request;
-
-            // adding request infomation to buffer json
-            request_buffer_json["ID"] = request_cast->robot_id;
-
-            request_buffer_json["Current_Cell"] = { { "x_pos", request_cast->current_cell.x},
-                                                    { "y_pos", request_cast->current_cell.y} }; 
-            
-            request_buffer_json["Target_Cell"] = { { "x_pos", request_cast->target_cell.x},
-                                                   { "y_pos", request_cast->target_cell.y} };
-            break;
-        }
-    }
-    if(response != NULL){
-        switch(response->request_type){ // switch to determine which type of response is being sent
-                                    // this is required inorder to typecast and export the appropriate information
-            case shutDownRequest_ID:
-            {
-                // no response required thus no print out
-
-                break;
-            }
-            case addRobotRequest_ID:
-            {
-                // typecast to appropriate child class to gather response data
-                m_addRobotResponse* response_cast = (m_addRobotResponse*) response;
-                
-                // adding request infomation to buffer json
-                response_buffer_json["Assigned_ID"] = response_cast->robot_id;
-
-                break;
-            }
-            case updateGlobalMapRequest_ID:
-            {
-                // no response required thus no print out
-
-                break;
-            }
-            case move2CellRequest_ID:
-            {
-                // typecast to appropriate child class to gather response data
-                m_move2CellResponse* response_cast = (m_move2CellResponse*) response;
-                
-                // need to convert bool info into y/n
-                char can_movement_occur = 'n';
-                if (response_cast->can_movement_occur)
-                    can_movement_occur = 'y';
-
-                // adding request infomation to buffer json
-                response_buffer_json["Movement_Occured"] = can_movement_occur;
-                
-                break;
-            }
-            case reserveCellRequest_ID:
-            {
-                // typecast to appropriate child class to gather response data
-                m_reserveCellResponse* response_cast = (m_reserveCellResponse*) response;
-                
-                // need to convert bool info into y/n
-                std::string cell_reserved = "n";
-                if (response_cast->cell_reserved)
-                    cell_reserved = "y";
-
-                // adding request infomation to buffer json
-                response_buffer_json["Cell_Reserved"] = cell_reserved;
-
-                break;
-            }
-            case updateRobotLocationRequest_ID:
-            {
-                // no response required thus no print out
-
-                break;
-            }
-            case getMapRequest_ID:
-            {
-                // no data loaded into response as only map information is in response
-                break;
-            }
-        }
-    }
-
-    // transaction information has been encapsulated into two seperate jsons
-    // they can now be combined in a buffer json and then added to the main "RequestInfo" JSON
-    json request_json;
-    request_json["Type"] = request->request_type;
-    request_json["Request"] = request_buffer_json;
-    request_json["Response"] = response_buffer_json;
-    request_json["Transaction"] = transaction_id;
-    
-    RequestInfo.push_back(request_json); // adding generated json to RequestInfo json
-
-    return; 
-}
-
 std::string RobotMaster::printGlobalMap(){ // function to print global map of maze including robot location
                                      // maze design based off what can be seen here: https://www.chegg.com/homework-help/questions-and-answers/using-c-1-write-maze-solving-program-following-functionality-note-implementation-details-a-q31826669
     
@@ -668,7 +556,7 @@ std::string RobotMaster::printGlobalMap(){ // function to print global map of ma
         if(count == 0){ // printing the horizontal walls of maze
 
             for(int j = 0; j < maze_xsize; j++){
-                if(GlobalMap->y_edges[i][j]){ // if there is no edge between two nodes
+                if(GlobalMap->getYEdge(j, i)){ // if there is no edge between two nodes
                     string_pointer = 1; // print horizontal line
                 }
                 else{ // if there is an edge between two nodes
@@ -683,7 +571,7 @@ std::string RobotMaster::printGlobalMap(){ // function to print global map of ma
             for(int j = 0; j < maze_xsize + 1; j++){
 
                 // checking the walls between two nodes (e.g. wall?, no wall?)
-                if(GlobalMap->x_edges[i][j]){ // if there is no edge between two nodes
+                if(GlobalMap->getXEdge(j, i)){ // if there is no edge between two nodes
                     string_pointer = 2; // print horizontal line
                 }
                 else{ // if there is an edge between two nodes
@@ -701,10 +589,10 @@ std::string RobotMaster::printGlobalMap(){ // function to print global map of ma
                     string_stream << fmt::format("{0:2d} ", *found_id);
                     string_pointer = -1; // print nothing after this ifelse statement as the printing has been handled locally
                 }
-                else if(GlobalMap->nodes[i][j] == 0){ // if current node is invalid (unseen and unexplored)
+                else if(GlobalMap->getNode(j, i) == 0){ // if current node is invalid (unseen and unexplored)
                     string_pointer = 6; // print I for invalid cell
                 }
-                else if(GlobalMap->nodes[i][j] == 2){ // if current node has been seen but not explored
+                else if(GlobalMap->getNode(j, i) == 2){ // if current node has been seen but not explored
                     string_pointer = 7; // print * for seen node
                 }
                 else{ // if current cell has been seen and explored (valid)
@@ -734,24 +622,188 @@ std::string RobotMaster::printGlobalMap(){ // function to print global map of ma
     return string_stream.str(); // returning string of printout for later usage
 }
 
+void RobotMaster::getRobotPositions(std::vector<Coordinates>* positions){
+
+    positions->resize(num_of_added_robots);
+
+    for(int i = 0; i < num_of_added_robots; i++){
+        if(i < robot_lookup.size() && robot_lookup[i] != NULL){
+            (*positions)[i] = robot_lookup[i]->robot_position;
+        }
+        else{ // robot has been removed
+            (*positions)[i] = NULL_COORDINATE;
+        }
+    }
+
+    return;
+}
+
 void RobotMaster::setGlobalMap(GridGraph* g){ 
     *GlobalMap = *g;
     
-    for(int i = 0; i < GlobalMap->nodes.size(); i++){ // need to account for all unexplored cells in new map
-        for(int j = 0; j < GlobalMap->nodes[i].size(); j++){
-            if(GlobalMap->nodes[i][j] == 2)
+    for(int i = 0; i < GlobalMap->getYSize(); i++){ // need to account for all unexplored cells in new map
+        for(int j = 0; j < GlobalMap->getXSize(); j++){
+            if(GlobalMap->getNode(j, i) == 2)
                 number_of_frontier_cells++;
         }
     }
+
+    if(Frontiers != NULL){
+        Frontiers->rebuild();
+    }
+
+    if(Oracle != NULL){ // rebuilding oracle from new map
+        delete Oracle;
+        Oracle = NULL;
+        enableDistanceOracle();
+    }
+}
+
+void RobotMaster::setPathPlanner(int planner_type){
+    PathPlanner* new_planner = createPathPlanner(planner_type); // allocating before deleting so Planner remains valid if type is invalid
+
+    delete Planner;
+    Planner = new_planner;
+
+    return;
+}
+
+void RobotMaster::enableDistanceOracle(){
+    if(Oracle != NULL){
+        return;
+    }
+
+    Oracle = new TreeDistanceOracle(maze_xsize, maze_ysize);
+
+    // passing current contents of GlobalMap to oracle
+    for(int y = 0; y < maze_ysize; y++){
+        for(int x = 0; x < maze_xsize; x++){
+            if(GlobalMap->getNode(x, y) > 0){ // seen cells are known to the oracle
+                Oracle->addCell(Coordinates(x, y));
+            }
+        }
+    }
+
+    for(int y = 0; y < maze_ysize; y++){
+        for(int x = 0; x < maze_xsize; x++){
+            if(GlobalMap->getNode(x, y) != 1){ // only explored cells have known walls
+                continue;
+            }
+
+            std::vector<Coordinates> neighbours = getSeenNeighbours(x, y);
+
+            for(int i = 0; i < neighbours.size(); i++){
+                Oracle->addConnection(Coordinates(x, y), neighbours[i]);
+            }
+        }
+    }
+
+    return;
+}
+
+void RobotMaster::enableFrontierField(){
+    if(Frontiers == NULL){
+        Frontiers = new FrontierDistanceField(GlobalMap); // built from current contents of GlobalMap
+    }
+
+    return;
 }
 
 RobotInfo* RobotMaster::getRobotInfo(unsigned int id){
 
-    for(int i = 0; i < tracked_robots.size(); i++){
-        if(tracked_robots[i].robot_id == id){ // if robot found
-            return &tracked_robots[i]; // return pointer to RobotInfo
+    if(id == 0 || id > robot_lookup.size()){ // ids start from 1
+        return NULL; // if robot not found, return NULL pointer
+    }
+
+    return robot_lookup[id - 1]; // NULL if robot has been removed
+}
+
+int RobotMaster::startNewJob(RobotInfo* robot){
+    robot->job_epoch++; // robot sends the new epoch once it has received its target, every request in flight carries an older one
+
+    return robot->job_epoch;
+}
+
+// ** Robot Index Functions **
+
+void RobotMaster::setRobotPosition(RobotInfo* robot, Coordinates C){ // moves robot to cell in cell_occupants
+
+    if(robot->robot_position != NULL_COORDINATE){ // removing robot from its previous cell
+        std::vector<unsigned int>* occupants = &cell_occupants[cellIndex(robot->robot_position)];
+
+        for(int i = 0; i < occupants->size(); i++){ // only robots sharing a cell are searched
+            if((*occupants)[i] == robot->robot_id){
+                occupants->erase(occupants->begin() + i);
+                break;
+            }
+        }
+    }
+
+    robot->robot_position = C;
+
+    if(C != NULL_COORDINATE){
+        cell_occupants[cellIndex(C)].push_back(robot->robot_id);
+    }
+
+    return;
+}
+
+void RobotMaster::setRobotTarget(RobotInfo* robot, Coordinates C){ // sets target of robot in reserved_targets, NULL_COORDINATE clears target
+
+    if(robot->robot_target != NULL_COORDINATE){ // removing robot from its previous target
+        auto entry = reserved_targets.find(cellIndex(robot->robot_target));
+
+        if(entry != reserved_targets.end()){
+            std::vector<unsigned int>* targeting_robots = &entry->second;
+
+            for(int i = 0; i < targeting_robots->size(); i++){
+                if((*targeting_robots)[i] == robot->robot_id){
+                    targeting_robots->erase(targeting_robots->begin() + i);
+                    break;
+                }
+            }
+
+            if(targeting_robots->empty()){ // cell is no longer reserved
+                reserved_targets.erase(entry);
+            }
+        }
+    }
+
+    robot->robot_target = C;
+
+    if(C != NULL_COORDINATE){
+        reserved_targets[cellIndex(C)].push_back(robot->robot_id);
+    }
+
+    return;
+}
+
+RobotInfo* RobotMaster::getRobotInCell(Coordinates C, unsigned int ignored_id){ // gets a robot occupying cell other than ignored_id, NULL if none
+
+    std::vector<unsigned int>* occupants = &cell_occupants[cellIndex(C)];
+
+    for(int i = 0; i < occupants->size(); i++){
+        if((*occupants)[i] != ignored_id){
+            return getRobotInfo((*occupants)[i]);
+        }
+    }
+
+    return NULL;
+}
+
+RobotInfo* RobotMaster::getRobotTargetingCell(Coordinates C, unsigned int ignored_id){ // gets a robot whose target is cell other than ignored_id, NULL if none
+
+    auto entry = reserved_targets.find(cellIndex(C));
+
+    if(entry == reserved_targets.end()){ // cell is not reserved
+        return NULL;
+    }
+
+    for(int i = 0; i < entry->second.size(); i++){
+        if(entry->second[i] != ignored_id){
+            return getRobotInfo(entry->second[i]);
         }
     }
 
-    return NULL; // if robot not found, return NULL pointer
+    return NULL;
 }
\ No newline at end of file
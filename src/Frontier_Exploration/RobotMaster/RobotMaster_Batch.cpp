@@ -0,0 +1,246 @@
+#include "RobotMaster_Batch.h"
+
+RobotMaster_Batch::RobotMaster_Batch(){
+    queue_changed = false; // no requests have been queued
+    map_changes_at_last_assignment = 0;
+}
+
+RobotMaster_Batch::~RobotMaster_Batch(){
+
+}
+
+void RobotMaster_Batch::queueFrontierTargetRequest(Message* request){
+
+    // gathering incoming request data
+    m_getFrontierTargetRequest* request_data = &std::get<m_getFrontierTargetRequest>(request->msg_data);
+
+    if(isRequestStale(request, request_data->robot_id)){ // robot was given a target by a job swap after sending request, clearing it would leave the target unexplored
+        return; // robot ignores any response to request
+    }
+
+    clearRobotTarget(getRobotInfo(request_data->robot_id)); // previous target of robot can be given to any robot
+
+    QueuedRequest queued_request = {*request_data, request->transaction_id, num_of_receieve_transactions, request->job_epoch}; // copying request as message is discarded once handled
+    queued_requests.push_back(queued_request);
+    queue_changed = true;
+
+    return;
+}
+
+void RobotMaster_Batch::handleQueuedRequests(){ // assigns frontier cells to every held request and sends responses
+
+    // dropping requests of robots which were given a target by a job swap while waiting
+    for(int i = queued_requests.size() - 1; i >= 0; i--){
+        if(queued_requests[i].job_epoch != getRobotInfo(queued_requests[i].request_data.robot_id)->job_epoch){
+            queued_requests.erase(queued_requests.begin() + i);
+        }
+    }
+
+    if(queued_requests.empty() || (!queue_changed && getNumberofMapChanges() == map_changes_at_last_assignment)){ // waiting robots would be assigned nothing again
+        return;
+    }
+
+    queue_changed = false;
+    map_changes_at_last_assignment = getNumberofMapChanges();
+
+    int num_of_requests = queued_requests.size();
+
+    // noting how far each holding robot still has to travel to its reserved cell, as a closer waiting robot may take it
+    holder_distance.assign(GlobalMap->getXSize()*GlobalMap->getYSize(), -1);
+
+    for(auto entry = reserved_targets.begin(); entry != reserved_targets.end(); entry++){ // every entry is a cell which is the target of at least one robot
+        RobotInfo* holder = getRobotInfo(entry->second[0]);
+        holder_distance[Workspace.toIndex(holder->robot_target)] = holder->planned_path.size();
+    }
+
+    // waiting robots in the same cell are searched from once
+    std::map<int, int> group_of_cell;
+    group_cells.clear();
+    group_of_request.resize(num_of_requests);
+
+    for(int i = 0; i < num_of_requests; i++){
+        int start_index = Workspace.toIndex(queued_requests[i].request_data.current_cell);
+
+        if(group_of_cell.find(start_index) == group_of_cell.end()){
+            group_of_cell[start_index] = group_cells.size();
+            group_cells.push_back(start_index);
+        }
+
+        group_of_request[i] = group_of_cell[start_index];
+    }
+
+    // only the closest num_of_requests cells of each group need to be considered
+    // if a robot is assigned a cell further away, one of its closer cells must be unassigned and swapping to it would not increase the total distance
+    gatherClosestFrontierCells(num_of_requests);
+
+    std::map<int, int> column_of_cell; // column of each candidate cell within cost matrix
+    std::vector<int> cell_of_column;
+
+    for(int g = 0; g < group_cells.size(); g++){
+        for(int j = 0; j < group_frontiers[g].size(); j++){
+            int cell = search_entries[group_frontiers[g][j]].cell;
+
+            if(column_of_cell.find(cell) == column_of_cell.end()){
+                column_of_cell[cell] = cell_of_column.size();
+                cell_of_column.push_back(cell);
+            }
+        }
+    }
+
+    // generating cost matrix using distance from each robot to each of its group's closest cells
+    std::vector<std::vector<int>> cost(num_of_requests, std::vector<int>(cell_of_column.size(), NO_ASSIGNMENT_COST));
+
+    for(int i = 0; i < num_of_requests; i++){
+        const std::vector<int>* frontiers = &group_frontiers[group_of_request[i]];
+
+        for(int j = 0; j < frontiers->size(); j++){
+            cost[i][column_of_cell[search_entries[(*frontiers)[j]].cell]] = search_entries[(*frontiers)[j]].distance;
+        }
+    }
+
+    std::vector<int> assignment = solveAssignment(&cost); // assigning cells so total distance is lowest
+
+    std::vector<QueuedRequest> unassigned_requests; // robots which keep waiting for a cell
+
+    for(int i = 0; i < num_of_requests; i++){
+        std::deque<Coordinates> path_2_target;
+
+        if(assignment[i] < 0){ // responding without a cell would only send robot searching its LocalMap for cells other robots hold
+            unassigned_requests.push_back(queued_requests[i]);
+            continue;
+        }
+
+        const std::vector<int>* frontiers = &group_frontiers[group_of_request[i]];
+        int target = cell_of_column[assignment[i]];
+
+        for(int j = 0; j < frontiers->size(); j++){ // assigned cell is always one of the group's closest cells
+            if(search_entries[(*frontiers)[j]].cell == target){
+                getPathFromSearch((*frontiers)[j], &path_2_target);
+                break;
+            }
+        }
+
+        Coordinates target_cell = Workspace.toCoordinates(target);
+
+        if(RobotInfo* reserving_robot = isCellReserved(&target_cell, queued_requests[i].request_data.robot_id); reserving_robot != NULL){ // waiting robot is closer than robot holding cell
+
+            setRobotTarget(reserving_robot, NULL_COORDINATE); // setting robot target to an invalid value as previous robot now has no currently reserved cell
+
+            // target is invalid on previously reserving robot thus planned path must be cleared
+            if(reserving_robot->robot_moving){ // if the previously reserving robot is currently moving into a cell
+                if(reserving_robot->planned_path.size() > 1){ // if it only has one more move to complete
+                    reserving_robot->planned_path.erase(reserving_robot->planned_path.begin() + 1, reserving_robot->planned_path.end()); // erase all entries except next movement to prevent collisions
+                }
+            }
+            else{
+                reserving_robot->planned_path.clear(); // if the robot is not moving, can clear planned path so it wont continue to move
+            }
+
+            updateRobotState(2, reserving_robot->Robot_Message_Reciever); // tell previous reserving robot to find a new target
+        }
+
+        sendFrontierTargetResponse(&queued_requests[i].request_data, queued_requests[i].transaction_id, queued_requests[i].receive_transaction, &path_2_target);
+    }
+
+    queued_requests.swap(unassigned_requests);
+
+    return;
+}
+
+// function to handle if there is two robots who are reserving the same cell
+// robot which reserved cell first keeps it, as waiting robots are assigned unreserved cells this is only used by robots searching their LocalMap
+void RobotMaster_Batch::handleAlreadyReservedCell(RobotInfo*, RobotInfo*, const MessageVector<Coordinates>*, m_reserveCellResponse* response_data, Coordinates target_cell){ // which robots are competing does not matter as first robot keeps cell
+
+    response_data->target_cell = target_cell; // adding target cell to response so robot knows which cell is already reserved by another robot
+    response_data->cell_reserved = false; // adding information about cell not being reserved to response
+
+    return;
+}
+
+void RobotMaster_Batch::gatherClosestFrontierCells(int max_cells){
+    // cells are searched using the same rules as a robot's LocalMap (only explored cells are expanded)
+    // every group starts at distance 0 and entries are popped in the order they were reached, so each group reaches cells in order of distance
+    // a group stops being expanded once it has found max_cells frontier cells
+
+    int num_of_groups = group_cells.size();
+
+    search_entries.clear();
+    cell_labels.assign(GlobalMap->getXSize()*GlobalMap->getYSize()*BATCH_LABELS_PER_CELL, -1);
+    group_frontiers.resize(num_of_groups);
+
+    for(int g = 0; g < num_of_groups; g++){
+        group_frontiers[g].clear();
+
+        labelCell(group_cells[g], g);
+        search_entries.push_back({group_cells[g], g, 0, -1});
+    }
+
+    int groups_finished = 0; // groups which have found max_cells frontier cells
+
+    for(int k = 0; k < search_entries.size() && groups_finished < num_of_groups; k++){
+        SearchEntry curr = search_entries[k]; // copied as search_entries may grow
+
+        if(group_frontiers[curr.group].size() >= max_cells){ // group has found enough cells
+            continue;
+        }
+
+        Coordinates curr_node = Workspace.toCoordinates(curr.cell);
+
+        if(curr.parent >= 0 && GlobalMap->getNode(curr_node.x, curr_node.y) == 2){ // unexplored cells are never expanded
+            if(isCandidateCell(curr.cell, curr.distance)){
+                group_frontiers[curr.group].push_back(k);
+
+                if(group_frontiers[curr.group].size() == max_cells){
+                    groups_finished++;
+                }
+            }
+
+            continue;
+        }
+
+        std::vector<Coordinates> neighbours = getSeenNeighbours(curr_node.x, curr_node.y);
+
+        for(int i = 0; i < neighbours.size(); i++){
+            int neighbour_index = Workspace.toIndex(neighbours[i]);
+
+            if(labelCell(neighbour_index, curr.group)){
+                search_entries.push_back({neighbour_index, curr.group, curr.distance + 1, k});
+            }
+        }
+    }
+
+    return;
+}
+
+bool RobotMaster_Batch::labelCell(int cell, int group){ // offers cell to group, returns false if group has already reached it or cell has been offered to enough groups
+
+    int* labels = &cell_labels[cell*BATCH_LABELS_PER_CELL];
+
+    for(int i = 0; i < BATCH_LABELS_PER_CELL; i++){
+        if(labels[i] == group){ // group has already reached cell
+            return false;
+        }
+
+        if(labels[i] < 0){ // free slot
+            labels[i] = group;
+            return true;
+        }
+    }
+
+    return false; // closer groups have taken every slot
+}
+
+bool RobotMaster_Batch::isCandidateCell(int cell, int distance){ // whether frontier cell can be assigned to a robot at distance from it
+    return holder_distance[cell] < 0 || distance < holder_distance[cell]; // robot holding cell keeps it unless the waiting robot is closer, the same as greedy reservation
+}
+
+void RobotMaster_Batch::getPathFromSearch(int entry, std::deque<Coordinates>* path){
+
+    path->clear();
+
+    for(int curr = entry; search_entries[curr].parent >= 0; curr = search_entries[curr].parent){ // walking back from cell through parent entries, group's cell has no parent
+        path->push_front(Workspace.toCoordinates(search_entries[curr].cell));
+    }
+
+    return;
+}
@@ -11,82 +11,155 @@ RobotMaster_CellReservation::~RobotMaster_CellReservation(){
 void RobotMaster_CellReservation::reserveCellRequest(Message* request){
     // reserveCell request msg_data layout:
     // [0] = type: (unsigned int*), content: id of robot sending request
-    // [1] = type: (Coordinates*), content: target unexplored cell to reseve
-    // [2] = type: (Coordinates*), content: neighbouring cell used to enter target cell 
+    // [1] = type: (Coordinates*), content: neighbouring cell used to enter target cell 
                                             // used to determine what aspect of tree must be sent back in event node has already been explored 
+    // payload path = planned path to target unexplored cell to reserve
     // return data
     // [0] = type (bool*), content: whether cell has been reserved
-    // [1] = type (vector<Coordinates>*), content: coordinates correspoonding to full map down a node path if path has been explored already
-    // [2] = type (vector<vector<bool>>*), content: wall information corresponding to cell locations in [1] 
-    // [3] = type (vector<char>*), content: information on node status
+    // payload map = full map down a node path if path has been explored already
 
     // gathering incoming request data
-    m_reserveCellRequest* request_data = (m_reserveCellRequest*)request->msg_data;
+    m_reserveCellRequest* request_data = &std::get<m_reserveCellRequest>(request->msg_data);
+    const MessageVector<Coordinates>* requested_path = &request->Payload->path;
     
     unsigned int robot_id = request_data->robot_id;
-    Coordinates target_cell = request_data->planned_path.back();                    
+    Coordinates target_cell = requested_path->back();                    
     Coordinates neighbouring_cell = request_data->neighbouring_cell;
 
+    RequestHandler* robot_request_handler = getTargetRequestHandler(robot_id); // getting request handler to send response
+
+    if(robot_request_handler == NULL){ // robot has been removed, no response can be sent
+        return;
+    }
+
+    if(isRequestStale(request, robot_id)){ // robot was given a new target by master after sending request, reserving cell would replace it
+        return; // robot ignores any response to request
+    }
+
     RobotInfo* robot_info = getRobotInfo(robot_id); // gathering robot who wants to reserve the cell
     
     robot_info->planned_path.clear(); // clearing planned path and robot moving flag in the event that these are set despite robot not moving
     robot_info->robot_moving = false; // these may not be set if robot has sent a message saying he will move but then receives a request to find a new target
 
-    // return data allocation
-    m_reserveCellResponse* response_data = new m_reserveCellResponse; // response message
+    // response message, data and payload are filled in place
+    Message response(t_Response, request->transaction_id, m_reserveCellResponse(), robot_request_handler->getPayload()); // creating new response with given response id
+    m_reserveCellResponse* response_data = &std::get<m_reserveCellResponse>(response.msg_data);
 
     // processing if cell can be reserved
-    // in this case, vectors allocated in response_data will be modified
-    if(GlobalMap->nodes[target_cell.y][target_cell.x] == 1){ // if the target cell has already been explored
+    // in this case, map of payload will be filled
+    if(GlobalMap->getNode(target_cell.x, target_cell.y) == 1){ // if the target cell has already been explored
         // gathering portion of map outwards from unexplored node to return to robot inorder to expand its LocalMap
-        gatherPortionofMap(target_cell, neighbouring_cell, response_data->map_coordinates, response_data->map_connections, response_data->map_status);
+        gatherPortionofMap(target_cell, neighbouring_cell, response.Payload);
         
         response_data->cell_reserved = false; // adding information about cell not being reserved to response
     }
     else if(RobotInfo* reserving_robot = isCellReserved(&target_cell, robot_id); reserving_robot == NULL){ // no other robot has reserved the target cell and it has not been explored
         
-        reserveCell(robot_info, &request_data->planned_path, target_cell); // reserving target cell + updating current planned path
+        reserveCell(robot_info, requested_path, target_cell); // reserving target cell + updating current planned path
 
         response_data->cell_reserved = true; // adding information about cell being reserved to response
     }
     else{ // if two robots are trying to reserve the same cell
-        handleAlreadyReservedCell(robot_info, reserving_robot, request_data, response_data, target_cell); // handle this using an approach specified in a child class
+        handleAlreadyReservedCell(robot_info, reserving_robot, requested_path, response_data, target_cell); // handle this using an approach specified in a child class
     }
    
-    exportRequestInfo2JSON(request_data, response_data, num_of_receieve_transactions); // adding request info to tracking JSON
+    exportRequestInfo2Trace(request->msg_data, request->Payload, &response.msg_data, response.Payload, num_of_receieve_transactions); // adding request info to request trace
 
-    // attaching response data to message
-    Message* response = new Message(t_Response, request->transaction_id); // creating new response with given response id
+    robot_request_handler->sendMessage(std::move(response)); // sending message
 
-    RequestHandler* robot_request_handler = getTargetRequestHandler(robot_id); // getting request handler to send response
+    return;
+}
 
-    if (robot_request_handler != NULL){ // if request handler gathered send data
-        response->msg_data = response_data; // assigning response to message
+void RobotMaster_CellReservation::getFrontierTargetRequest(Message* request){
 
-        robot_request_handler->sendMessage(response); // sending message
+    // gathering incoming request data
+    m_getFrontierTargetRequest* request_data = &std::get<m_getFrontierTargetRequest>(request->msg_data);
+
+    if(isRequestStale(request, request_data->robot_id)){ // robot was given a target by a job swap after sending request, clearing it would leave the target unexplored
+        return; // robot ignores any response to request
     }
-    else{ // if no request handler found, must delete response data
-        delete response_data;
-        delete response;
+
+    clearRobotTarget(getRobotInfo(request_data->robot_id)); // previous target of robot can be given to any robot
+
+    enableFrontierField(); // field is built on first request then maintained through every GlobalMap change
+    updateReservedFrontierCells(); // cells reserved by other robots must not be selected
+
+    std::deque<Coordinates> path_2_target;
+    Frontiers->getPathToFrontier(request_data->current_cell, &path_2_target); // following field from robot to its closest unreserved frontier cell
+
+    sendFrontierTargetResponse(request_data, request->transaction_id, num_of_receieve_transactions, &path_2_target);
+
+    return;
+}
+
+void RobotMaster_CellReservation::sendFrontierTargetResponse(m_getFrontierTargetRequest* request_data, int transaction_id, unsigned int receive_transaction, std::deque<Coordinates>* path_2_target){
+
+    unsigned int robot_id = request_data->robot_id;
+
+    RequestHandler* robot_request_handler = getTargetRequestHandler(robot_id); // getting request handler to send response
+
+    if(robot_request_handler == NULL){ // robot has been removed, no response can be sent
+        return;
     }
+
+    // response message, data and payload are filled in place
+    Message response(t_Response, transaction_id, m_getFrontierTargetResponse(), robot_request_handler->getPayload()); // creating new response with given response id
+    m_getFrontierTargetResponse* response_data = &std::get<m_getFrontierTargetResponse>(response.msg_data);
+    MessagePayload* payload = response.Payload;
+
+    response_data->target_found = !path_2_target->empty();
+
+    if(response_data->target_found){
+        payload->path.assign(path_2_target->begin(), path_2_target->end());
+
+        reserveCell(getRobotInfo(robot_id), &payload->path, path_2_target->back()); // reserving target cell + updating current planned path
+
+        // gathering map information along path so robot can follow it using its LocalMap
+        addMapCell(request_data->current_cell, payload);
+
+        for(int i = 0; i < path_2_target->size(); i++){
+            addMapCell((*path_2_target)[i], payload);
+        }
+    }
+
+    exportRequestInfo2Trace(*request_data, NULL, &response.msg_data, payload, receive_transaction); // adding request info to request trace
+
+    robot_request_handler->sendMessage(std::move(response)); // sending message
+
     return;
 }
 
-void RobotMaster_CellReservation::reserveCell(RobotInfo* robot_info, std::deque<Coordinates>* path_2_target , Coordinates target_cell){
+void RobotMaster_CellReservation::clearRobotTarget(RobotInfo* robot_info){ // clears target and planned path of a robot which is searching for a new target
+
+    robot_info->planned_path.clear(); // clearing planned path and robot moving flag as robot is searching for a new target
+    robot_info->robot_moving = false;
+    setRobotTarget(robot_info, NULL_COORDINATE);
+
+    return;
+}
+
+void RobotMaster_CellReservation::reserveCell(RobotInfo* robot_info, const MessageVector<Coordinates>* path_2_target , Coordinates target_cell){
     
-    robot_info->planned_path = *path_2_target; // setting planned path of robot
-    robot_info->robot_target = target_cell; // setting new target cell in robot's robot_info
+    robot_info->planned_path.assign(path_2_target->begin(), path_2_target->end()); // setting planned path of robot
+    setRobotTarget(robot_info, target_cell); // setting new target cell in robot's robot_info
 
     return;
 }
 
 
 RobotInfo* RobotMaster_CellReservation::isCellReserved(Coordinates* target_cell, unsigned int robot_id){ // determines if another robot has already reserved the cell
-    for(int i = 0; i < tracked_robots.size(); i++){
-        if(tracked_robots[i].robot_target == *target_cell && tracked_robots[i].robot_id != robot_id){ // if the cell is currently a different robot's target
-            return &(tracked_robots[i]);
-        }
+    return getRobotTargetingCell(*target_cell, robot_id); // if the cell is currently a different robot's target
+}
+
+void RobotMaster_CellReservation::updateReservedFrontierCells(){ // excludes every robot's target cell from Frontiers
+
+    std::vector<Coordinates> reserved_cells;
+
+    for(auto entry = reserved_targets.begin(); entry != reserved_targets.end(); entry++){ // every entry is a cell which is the target of at least one robot
+        reserved_cells.push_back(getRobotInfo(entry->second[0])->robot_target);
     }
 
-    return NULL;
+    Frontiers->setExcludedCells(&reserved_cells); // only cells whose reservation has changed are updated
+
+    return;
 }
\ No newline at end of file
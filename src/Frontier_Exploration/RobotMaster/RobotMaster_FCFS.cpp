@@ -10,13 +10,13 @@ RobotMaster_FCFS::~RobotMaster_FCFS(){
 
 // function to handle if there is two robots who are reserving the same cell
 // this is the "first come, first serve" implementation (e.g. if two robots are reserving the same cell, let the robot who reserved it first keep it unless the current robot is adjacent to the cell)
-void RobotMaster_FCFS::handleAlreadyReservedCell(RobotInfo* current_robot, RobotInfo* reserving_robot, m_reserveCellRequest* request_data, m_reserveCellResponse* response_data, Coordinates target_cell){
+void RobotMaster_FCFS::handleAlreadyReservedCell(RobotInfo* current_robot, RobotInfo* reserving_robot, const MessageVector<Coordinates>* requested_path, m_reserveCellResponse* response_data, Coordinates target_cell){
 
-    if(request_data->planned_path.size() == 1 && reserving_robot->planned_path.size() > 1){ // if the current robot is adjacent to the cell and the currently reserving robot is not adjacent
+    if(requested_path->size() == 1 && reserving_robot->planned_path.size() > 1){ // if the current robot is adjacent to the cell and the currently reserving robot is not adjacent
         
-        reserveCell(current_robot, &request_data->planned_path, target_cell); // reserving target cell + updating current planned path
+        reserveCell(current_robot, requested_path, target_cell); // reserving target cell + updating current planned path
         
-        reserving_robot->robot_target = NULL_COORDINATE; // setting robot target to an invalid value as previous robot now has no currently reserved cell
+        setRobotTarget(reserving_robot, NULL_COORDINATE); // setting robot target to an invalid value as previous robot now has no currently reserved cell
         
         // target is invalid on previously revsering robot thus planned path muct be cleared
         if(reserving_robot->robot_moving){ // if the previously reserving robot is currently moving into a cell
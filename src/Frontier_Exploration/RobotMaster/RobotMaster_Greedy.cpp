@@ -10,17 +10,28 @@ RobotMaster_Greedy::~RobotMaster_Greedy(){
 
 // function to handle if there is two robots who are reserving the same cell
 // this is the "greedy" implementation (e.g. if two robots are reserving the same cell, let the closer robot keep the reservation)
-void RobotMaster_Greedy::handleAlreadyReservedCell(RobotInfo* current_robot, RobotInfo* reserving_robot, m_reserveCellRequest* request_data, m_reserveCellResponse* response_data, Coordinates target_cell){
+void RobotMaster_Greedy::handleAlreadyReservedCell(RobotInfo* current_robot, RobotInfo* reserving_robot, const MessageVector<Coordinates>* requested_path, m_reserveCellResponse* response_data, Coordinates target_cell){
     
-    if(reserving_robot->planned_path.size() <= request_data->planned_path.size()){ // if the target cell has already been reserved and the reserving robot is closer to the target
+    bool reserving_robot_closer = reserving_robot->planned_path.size() <= requested_path->size(); // comparing planned path lengths by default
+
+    if(Oracle != NULL){ // if distance oracle is enabled, compare distances through the entire known map instead
+        int reserving_distance = getKnownDistance(reserving_robot->robot_position, target_cell);
+        int current_distance = getKnownDistance(current_robot->robot_position, target_cell);
+
+        if(reserving_distance >= 0 && current_distance >= 0){
+            reserving_robot_closer = reserving_distance <= current_distance;
+        }
+    }
+
+    if(reserving_robot_closer){ // if the target cell has already been reserved and the reserving robot is closer to the target
         response_data->target_cell = target_cell; // adding target cell to response so robot knows which cell is already reserved by another robot
         response_data->cell_reserved = false; // adding information about cell not being reserved to response
     }
     else{ // if the current robot is closer to the target cell than the current reserving robot
 
-        reserveCell(current_robot, &request_data->planned_path, target_cell); // reserving target cell + updating current planned path
+        reserveCell(current_robot, requested_path, target_cell); // reserving target cell + updating current planned path
 
-        reserving_robot->robot_target = NULL_COORDINATE; // setting robot target to an invalid value as previous robot now has no currently reserved cell
+        setRobotTarget(reserving_robot, NULL_COORDINATE); // setting robot target to an invalid value as previous robot now has no currently reserved cell
         
         // target is invalid on previously revsering robot thus planned path muct be cleared
         if(reserving_robot->robot_moving){ // if the previously reserving robot is currently moving into a cell
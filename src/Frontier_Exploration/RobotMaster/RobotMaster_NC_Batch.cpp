@@ -0,0 +1,46 @@
+#include "RobotMaster_NC_Batch.h"
+
+RobotMaster_NC_Batch::RobotMaster_NC_Batch(RequestHandler* r, int num_of_robots, unsigned int xsize, unsigned int ysize): RobotMaster(r, num_of_robots, xsize, ysize){
+
+}
+
+RobotMaster_NC_Batch::~RobotMaster_NC_Batch(){
+
+}
+
+void RobotMaster_NC_Batch::handleIncomingRequest(Message* incoming_request){
+
+    std::visit(MessageVisitor{ // calling the function for the type of request received
+        [&](m_addRobotRequest&){ // addRobot request
+            addRobotRequest(incoming_request);
+
+            // if all robots have been added
+            // send signal to all robots to begin exploration
+            if(tracked_robots.size() == num_of_robots)
+                updateAllRobotState(1); // updating all robot states to 1
+                                        // this causes them to all begin exploring by first scanning their cell
+        },
+        [&](m_updateGlobalMapRequest&){ // updateGlobalMap request
+            updateGlobalMapRequest(incoming_request);
+
+            if(number_of_frontier_cells < 1){ // if no more cells to explore
+                updateAllRobotState(-1); // tell all robots to shut down
+                accepting_requests = false; // set robot master to ignore all incoming requests which are not a shut down request
+            }
+        },
+        [&](m_reserveCellRequest&){ // reserveCell request (robot wants to start exploring from a cell without other robots using it)
+            reserveCellRequest(incoming_request);
+        },
+        [&](m_getFrontierTargetRequest&){ // getFrontierTarget request (held until every request of this turn has been handled)
+            queueFrontierTargetRequest(incoming_request);
+        },
+        [&](m_updateRobotLocationRequest&){ // update Robot Location  (tells master that robot has completed move operation)
+            updateRobotLocationRequest(incoming_request);
+        },
+        [&](auto&){ // other messages are not handled by this RobotMaster
+
+        }
+    }, incoming_request->msg_data);
+
+    return;
+}
\ No newline at end of file
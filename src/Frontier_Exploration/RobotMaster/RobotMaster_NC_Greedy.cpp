@@ -10,12 +10,8 @@ RobotMaster_NC_Greedy::~RobotMaster_NC_Greedy(){
 
 void RobotMaster_NC_Greedy::handleIncomingRequest(Message* incoming_request){
 
-    m_genericRequest* r = (m_genericRequest*) incoming_request->msg_data; // use generic message pointer to gather request type
-
-    switch (r->request_type){ // determining type of request before processing
-
-        case addRobotRequest_ID: // addRobot request
-        {
+    std::visit(MessageVisitor{ // calling the function for the type of request received
+        [&](m_addRobotRequest&){ // addRobot request
             addRobotRequest(incoming_request);
 
             // if all robots have been added
@@ -23,36 +19,28 @@ void RobotMaster_NC_Greedy::handleIncomingRequest(Message* incoming_request){
             if(tracked_robots.size() == num_of_robots)
                 updateAllRobotState(1); // updating all robot states to 1
                                         // this causes them to all begin exploring by first scanning their cell
-            break;
-        }
-        case updateGlobalMapRequest_ID: // updateGlobalMap request
-        {   
+        },
+        [&](m_updateGlobalMapRequest&){ // updateGlobalMap request
             updateGlobalMapRequest(incoming_request);
 
             if(number_of_frontier_cells < 1){ // if no more cells to explore
                 updateAllRobotState(-1); // tell all robots to shut down
                 accepting_requests = false; // set robot master to ignore all incoming requests which are not a shut down request
             }
-
-            break;
-        }
-        case reserveCellRequest_ID: // reserveCell request (robot wants to start exploring from a cell without other robots using it)
-        {
+        },
+        [&](m_reserveCellRequest&){ // reserveCell request (robot wants to start exploring from a cell without other robots using it)
             reserveCellRequest(incoming_request);
-
-            break;
-        }
-        case updateRobotLocationRequest_ID: // update Robot Location  (tells master that robot has completed move operation)
-        {
+        },
+        [&](m_getFrontierTargetRequest&){ // getFrontierTarget request (robot wants master to reserve closest unreserved cell for it)
+            getFrontierTargetRequest(incoming_request);
+        },
+        [&](m_updateRobotLocationRequest&){ // update Robot Location  (tells master that robot has completed move operation)
             updateRobotLocationRequest(incoming_request);
+        },
+        [&](auto&){ // other messages are not handled by this RobotMaster
 
-            break;
-        }
-        default:
-        {
-            break;
         }
-    }
+    }, incoming_request->msg_data);
 
     return;
 }
\ No newline at end of file
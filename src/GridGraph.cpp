@@ -4,18 +4,18 @@ void printNodes(GridGraph* m){ // prints nodes of the referenced grid graph
 
     printf(" # |"); 
 
-    for (int i = 0; i < 32; i++) // printing column numbers
+    for (int i = 0; i < m->getXSize(); i++) // printing column numbers
         printf(" %-2d",i);
 
     printf("\n   "); // new line
     
-    for (int i = 0; i < 32; i++) // printing divider from column numbers
+    for (int i = 0; i < m->getXSize(); i++) // printing divider from column numbers
         printf("---");
 
-    for (int i = 0; i < 31; i++){
+    for (int i = 0; i < m->getYSize(); i++){
         printf("\n%3d|",i);
-        for (int j = 0; j < 31; j++)
-            printf(" %-2d",m->nodes[i][j]);
+        for (int j = 0; j < m->getXSize(); j++)
+            printf(" %-2d",m->getNode(j, i));
     }
 
     printf("\n");
@@ -27,18 +27,18 @@ void printXEdges(GridGraph* m){ // prints x_edge of the referenced grid graph
 
     printf(" # |"); 
 
-    for (int i = 0; i < 32; i++) // printing column numbers
+    for (int i = 0; i < m->getXSize() + 1; i++) // printing column numbers
         printf(" %-2d",i);
 
     printf("\n   "); // new line
     
-    for (int i = 0; i < 32; i++) // printing divider from column numbers
+    for (int i = 0; i < m->getXSize() + 1; i++) // printing divider from column numbers
         printf("---");
 
-    for (int i = 0; i < 32; i++){ // print x_edge matrix
+    for (int i = 0; i < m->getYSize(); i++){ // print x_edge matrix
         printf("\n%3d|",i);
-        for (int j = 0; j < 32; j++)
-            printf(" %-2d",static_cast<int>(m->x_edges[i][j]));
+        for (int j = 0; j < m->getXSize() + 1; j++)
+            printf(" %-2d",static_cast<int>(m->getXEdge(j, i)));
     }
 
     printf("\n");
@@ -50,18 +50,18 @@ void printYEdges(GridGraph* m){ // prints y_edge of the referenced grid graph
 
     printf(" # |"); 
 
-    for (int i = 0; i < 32; i++) // printing column numbers
+    for (int i = 0; i < m->getXSize(); i++) // printing column numbers
         printf(" %-2d",i);
 
     printf("\n   "); // new line to allow table to be printed below column numbers
     
-    for (int i = 0; i < 32; i++) // printing divider from column numbers
+    for (int i = 0; i < m->getXSize(); i++) // printing divider from column numbers
         printf("---");
 
-    for (int i = 0; i < 32; i++){ // print x_edge matrix
+    for (int i = 0; i < m->getYSize() + 1; i++){ // print y_edge matrix
         printf("\n%3d|",i);
-        for (int j = 0; j < 32; j++)
-            printf(" %-2d", static_cast<int>(m->y_edges[i][j]));
+        for (int j = 0; j < m->getXSize(); j++)
+            printf(" %-2d", static_cast<int>(m->getYEdge(j, i)));
     }
 
     printf("\n");
@@ -0,0 +1,458 @@
+#include "ImageEncoders.h"
+
+#include <fstream>
+#include <string>
+#include <algorithm>
+#include <cstring>
+
+// ~~~ Bit Packing Helpers ~~~
+
+struct BitWriter{ // packs codes least significant bit first, as used by both deflate and gif
+    std::vector<uint8_t>* out;
+    uint64_t bit_buffer = 0;
+    int bit_count = 0;
+
+    BitWriter(std::vector<uint8_t>* o){
+        out = o;
+    }
+
+    void write(uint32_t bits, int length){
+        bit_buffer |= (uint64_t)bits << bit_count;
+        bit_count += length;
+
+        while(bit_count >= 8){
+            out->push_back(bit_buffer & 0xFF);
+            bit_buffer >>= 8;
+            bit_count -= 8;
+        }
+    }
+
+    void writeReversed(uint32_t code, int length){ // huffman codes of deflate are packed most significant bit first
+        uint32_t reversed = 0;
+
+        for(int i = 0; i < length; i++){
+            reversed = (reversed << 1) | ((code >> i) & 1);
+        }
+
+        write(reversed, length);
+    }
+
+    void flush(){ // pads last byte with zeros
+        if(bit_count > 0){
+            out->push_back(bit_buffer & 0xFF);
+        }
+
+        bit_buffer = 0;
+        bit_count = 0;
+    }
+};
+
+static void appendUint16LE(std::vector<uint8_t>* out, uint16_t value){
+    out->push_back(value & 0xFF);
+    out->push_back(value >> 8);
+}
+
+static void appendUint32BE(std::vector<uint8_t>* out, uint32_t value){
+    out->push_back(value >> 24);
+    out->push_back((value >> 16) & 0xFF);
+    out->push_back((value >> 8) & 0xFF);
+    out->push_back(value & 0xFF);
+}
+
+static void appendString(std::vector<uint8_t>* out, std::string s){
+    out->insert(out->end(), s.begin(), s.end());
+}
+
+// ~~~ PNG Helpers ~~~
+
+static std::vector<uint32_t> buildCrcTable(){ // remainder of every byte value, used to process a byte at a time
+
+    std::vector<uint32_t> crc_table(256);
+
+    for(uint32_t i = 0; i < 256; i++){
+        uint32_t c = i;
+
+        for(int k = 0; k < 8; k++){
+            c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+        }
+        crc_table[i] = c;
+    }
+
+    return crc_table;
+}
+
+static uint32_t crc32(const uint8_t* data, size_t length){
+
+    static const std::vector<uint32_t> crc_table = buildCrcTable(); // built once on first use
+
+    uint32_t crc = 0xFFFFFFFF;
+
+    for(size_t i = 0; i < length; i++){
+        crc = crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+
+    return crc ^ 0xFFFFFFFF;
+}
+
+static uint32_t adler32(const std::vector<uint8_t>* data){
+
+    uint32_t a = 1, b = 0;
+
+    for(size_t i = 0; i < data->size(); i++){
+        a = (a + (*data)[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+
+    return (b << 16) | a;
+}
+
+static void appendPNGChunk(std::vector<uint8_t>* out, std::string type, const std::vector<uint8_t>* data){
+
+    appendUint32BE(out, data->size());
+
+    size_t type_start = out->size();
+    appendString(out, type);
+    out->insert(out->end(), data->begin(), data->end());
+
+    appendUint32BE(out, crc32(out->data() + type_start, out->size() - type_start)); // crc covers type and data
+}
+
+static void writeFixedLiteral(BitWriter* Bits, int value){ // writes literal/length symbol using fixed huffman codes of deflate
+
+    if(value < 144){
+        Bits->writeReversed(0x30 + value, 8);
+    }
+    else if(value < 256){
+        Bits->writeReversed(0x190 + value - 144, 9);
+    }
+    else if(value < 280){
+        Bits->writeReversed(value - 256, 7);
+    }
+    else{
+        Bits->writeReversed(0xC0 + value - 280, 8);
+    }
+}
+
+static void writeMatch(BitWriter* Bits, int length, int distance){ // writes a length, distance pair of deflate
+
+    static const int length_bases[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const int length_extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const int distance_bases[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const int distance_extra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    int length_code = 28;
+    while(length_bases[length_code] > length){ // finding largest base not above length
+        length_code--;
+    }
+
+    writeFixedLiteral(Bits, 257 + length_code);
+    Bits->write(length - length_bases[length_code], length_extra[length_code]);
+
+    int distance_code = 29;
+    while(distance_bases[distance_code] > distance){
+        distance_code--;
+    }
+
+    Bits->writeReversed(distance_code, 5); // fixed distance codes are all 5 bits
+    Bits->write(distance - distance_bases[distance_code], distance_extra[distance_code]);
+}
+
+static void deflateFixed(const std::vector<uint8_t>* data, int stride, std::vector<uint8_t>* out){ // compresses data as a single fixed huffman block
+                                                                                                   // matches are only searched for at a distance of 1 (runs) and stride (previous row), which covers almost every repeat in a maze
+    BitWriter Bits(out);
+
+    Bits.write(1, 1); // last block
+    Bits.write(1, 2); // fixed huffman codes
+
+    int distances[2] = { 1, stride };
+    int num_of_distances = (stride > 1 && stride <= 32768) ? 2 : 1; // deflate can only refer back 32768 bytes
+
+    size_t n = data->size();
+    size_t p = 0;
+
+    while(p < n){
+        int best_length = 0;
+        int best_distance = 0;
+
+        for(int d = 0; d < num_of_distances; d++){
+            if(p < (size_t)distances[d]){
+                continue;
+            }
+
+            int length = 0;
+            while(length < 258 && p + length < n && (*data)[p + length] == (*data)[p + length - distances[d]]){
+                length++;
+            }
+
+            if(length > best_length){
+                best_length = length;
+                best_distance = distances[d];
+            }
+        }
+
+        if(best_length >= 3){
+            writeMatch(&Bits, best_length, best_distance);
+            p += best_length;
+        }
+        else{
+            writeFixedLiteral(&Bits, (*data)[p]);
+            p++;
+        }
+    }
+
+    writeFixedLiteral(&Bits, 256); // end of block
+    Bits.flush();
+}
+
+// ~~~ GIF Helpers ~~~
+
+#define GIF_MIN_CODE_SIZE 4 // log2 of PALETTE_SIZE
+
+static void encodeLZW(const PaletteImage* Image, const PaletteImage* Previous, int left, int top, int width, int height, std::vector<uint8_t>* out){ // gif variant of lzw over rectangle of image
+                                                                                                                                                     // pixels which are the same in Previous are encoded as GIF_TRANSPARENT, Previous can be NULL
+    std::vector<uint8_t> code_bytes;
+    BitWriter Bits(&code_bytes);
+
+    const int clear_code = 1 << GIF_MIN_CODE_SIZE;
+    const int end_code = clear_code + 1;
+
+    std::vector<uint16_t> next_code(4096*PALETTE_SIZE, 0); // code of each string extended by a pixel, 0 if string is not in dictionary
+
+    int code_size = GIF_MIN_CODE_SIZE + 1;
+    int max_code = end_code;
+    int current_code = -1;
+
+    Bits.write(clear_code, code_size);
+
+    for(int y = top; y < top + height; y++){
+        const uint8_t* row = &Image->pixels[(size_t)y*Image->width];
+        const uint8_t* previous_row = (Previous != NULL) ? &Previous->pixels[(size_t)y*Image->width] : NULL;
+
+        for(int x = left; x < left + width; x++){
+            int pixel = (previous_row != NULL && previous_row[x] == row[x]) ? GIF_TRANSPARENT : row[x]; // unchanged pixels become long runs, which lzw encodes in a few codes
+
+            if(current_code < 0){
+                current_code = pixel;
+            }
+            else if(next_code[current_code*PALETTE_SIZE + pixel] != 0){ // string is already in dictionary
+                current_code = next_code[current_code*PALETTE_SIZE + pixel];
+            }
+            else{
+                Bits.write(current_code, code_size);
+
+                next_code[current_code*PALETTE_SIZE + pixel] = ++max_code;
+
+                if(max_code >= (1 << code_size)){
+                    code_size++;
+                }
+
+                if(max_code == 4095){ // dictionary is full, starting again
+                    Bits.write(clear_code, code_size);
+                    std::fill(next_code.begin(), next_code.end(), 0);
+
+                    code_size = GIF_MIN_CODE_SIZE + 1;
+                    max_code = end_code;
+                }
+
+                current_code = pixel;
+            }
+        }
+    }
+
+    Bits.write(current_code, code_size);
+
+    if(max_code + 1 == (1 << code_size) && code_size < 12){ // decoders add one last string after reading final code, which can widen codes before clear code is read
+        code_size++;
+    }
+
+    Bits.write(clear_code, code_size);
+    Bits.write(end_code, GIF_MIN_CODE_SIZE + 1);
+    Bits.flush();
+
+    for(size_t i = 0; i < code_bytes.size(); i += 255){ // image data is split into sub-blocks of up to 255 bytes
+        size_t block_size = std::min((size_t)255, code_bytes.size() - i);
+
+        out->push_back(block_size);
+        out->insert(out->end(), code_bytes.begin() + i, code_bytes.begin() + i + block_size);
+    }
+
+    out->push_back(0); // block terminator
+}
+
+// ** Image Encoding Functions **
+
+void encodePPM(const PaletteImage* Image, const PaletteColor* palette, std::vector<uint8_t>* out){
+
+    appendString(out, "P6\n" + std::to_string(Image->width) + " " + std::to_string(Image->height) + "\n255\n");
+
+    out->reserve(out->size() + Image->pixels.size()*3);
+
+    for(size_t i = 0; i < Image->pixels.size(); i++){
+        const PaletteColor* C = &palette[Image->pixels[i]];
+
+        out->push_back(C->r);
+        out->push_back(C->g);
+        out->push_back(C->b);
+    }
+
+    return;
+}
+
+void encodePNG(const PaletteImage* Image, const PaletteColor* palette, std::vector<uint8_t>* out){
+
+    const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    out->insert(out->end(), signature, signature + 8);
+
+    std::vector<uint8_t> chunk;
+
+    // ~~~ IHDR ~~~
+    appendUint32BE(&chunk, Image->width);
+    appendUint32BE(&chunk, Image->height);
+    chunk.push_back(8); // bit depth
+    chunk.push_back(3); // palette color type
+    chunk.push_back(0); // deflate compression
+    chunk.push_back(0); // adaptive filtering
+    chunk.push_back(0); // no interlace
+    appendPNGChunk(out, "IHDR", &chunk);
+
+    // ~~~ PLTE ~~~
+    chunk.clear();
+    for(int i = 0; i < PALETTE_SIZE; i++){
+        chunk.push_back(palette[i].r);
+        chunk.push_back(palette[i].g);
+        chunk.push_back(palette[i].b);
+    }
+    appendPNGChunk(out, "PLTE", &chunk);
+
+    // ~~~ IDAT ~~~
+    std::vector<uint8_t> raw; // every row is preceded by its filter type
+    raw.reserve((size_t)(Image->width + 1)*Image->height);
+
+    for(int y = 0; y < Image->height; y++){
+        raw.push_back(0); // no filter, repeated rows are found by deflate instead
+        raw.insert(raw.end(), Image->pixels.begin() + (size_t)y*Image->width, Image->pixels.begin() + (size_t)(y + 1)*Image->width);
+    }
+
+    chunk.clear();
+    chunk.push_back(0x78); // zlib header for deflate with a 32K window
+    chunk.push_back(0x01);
+    deflateFixed(&raw, Image->width + 1, &chunk);
+    appendUint32BE(&chunk, adler32(&raw));
+    appendPNGChunk(out, "IDAT", &chunk);
+
+    // ~~~ IEND ~~~
+    chunk.clear();
+    appendPNGChunk(out, "IEND", &chunk);
+
+    return;
+}
+
+void encodeGIFHeader(int width, int height, const PaletteColor* palette, std::vector<uint8_t>* out){
+
+    appendString(out, "GIF89a");
+    appendUint16LE(out, width);
+    appendUint16LE(out, height);
+    out->push_back(0xF3); // global palette of 16 colors
+    out->push_back(0); // background color
+    out->push_back(0); // square pixels
+
+    for(int i = 0; i < PALETTE_SIZE; i++){
+        out->push_back(palette[i].r);
+        out->push_back(palette[i].g);
+        out->push_back(palette[i].b);
+    }
+
+    const uint8_t loop_extension[19] = { 0x21, 0xFF, 11, 'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E', '2', '.', '0', 3, 1, 0, 0, 0 }; // loops forever
+    out->insert(out->end(), loop_extension, loop_extension + 19);
+
+    return;
+}
+
+void encodeGIFFrame(const PaletteImage* Image, const PaletteImage* Previous, int delay, std::vector<uint8_t>* out){
+
+    // ~~~ Finding Changed Rectangle ~~~
+    int left = 0, top = 0, right = Image->width - 1, bottom = Image->height - 1;
+
+    if(Previous != NULL && (Previous->width != Image->width || Previous->height != Image->height)){ // whole frame is encoded if sizes differ
+        Previous = NULL;
+    }
+
+    if(Previous != NULL){
+        left = Image->width;
+        top = Image->height;
+        right = -1;
+        bottom = -1;
+
+        for(int y = 0; y < Image->height; y++){
+            const uint8_t* row = &Image->pixels[(size_t)y*Image->width];
+            const uint8_t* previous_row = &Previous->pixels[(size_t)y*Image->width];
+
+            if(memcmp(row, previous_row, Image->width) == 0){ // most rows are unchanged between frames
+                continue;
+            }
+
+            int first_changed = 0;
+            while(row[first_changed] == previous_row[first_changed]){
+                first_changed++;
+            }
+
+            int last_changed = Image->width - 1;
+            while(row[last_changed] == previous_row[last_changed]){
+                last_changed--;
+            }
+
+            left = std::min(left, first_changed);
+            right = std::max(right, last_changed);
+            top = std::min(top, y);
+            bottom = y;
+        }
+
+        if(right < 0){ // frame is unchanged, a single pixel is still encoded so frame keeps its delay
+            left = 0;
+            top = 0;
+            right = 0;
+            bottom = 0;
+        }
+    }
+
+    // ~~~ Graphic Control Extension ~~~
+    out->push_back(0x21);
+    out->push_back(0xF9);
+    out->push_back(4);
+    out->push_back((1 << 2) | ((Previous != NULL) ? 1 : 0)); // previous frame is left in place beneath this one, showing through transparent pixels
+    appendUint16LE(out, delay);
+    out->push_back(GIF_TRANSPARENT);
+    out->push_back(0);
+
+    // ~~~ Image Descriptor ~~~
+    out->push_back(0x2C);
+    appendUint16LE(out, left);
+    appendUint16LE(out, top);
+    appendUint16LE(out, right - left + 1);
+    appendUint16LE(out, bottom - top + 1);
+    out->push_back(0); // global palette is used
+
+    out->push_back(GIF_MIN_CODE_SIZE);
+    encodeLZW(Image, Previous, left, top, right - left + 1, bottom - top + 1, out);
+
+    return;
+}
+
+void encodeGIFTrailer(std::vector<uint8_t>* out){
+    out->push_back(0x3B);
+
+    return;
+}
+
+bool writeFile(std::string file_name, const std::vector<uint8_t>* data){
+
+    std::ofstream file(file_name, std::ios::binary);
+
+    if(!file.is_open()){
+        return false;
+    }
+
+    file.write((const char*)data->data(), data->size());
+
+    return file.good();
+}
@@ -15,7 +15,7 @@ void Maze::generate4x4SampleMaze(){
 
     for (int i = 0; i < sizeof(n)/sizeof(n[0]); i++) // passing nodes into graph struct
         for (int j = 0; j < sizeof(n[0])/sizeof(n[0][0]); j++)
-            MazeMap.nodes[i][j] = n[i][j];
+            MazeMap.setNode(j, i, n[i][j]);
     
 
     char x[4][5] = { // marking x edges for maze
@@ -29,10 +29,10 @@ void Maze::generate4x4SampleMaze(){
     for (int i = 0; i < sizeof(x)/sizeof(x[0]); i++){ // outer loop (iterate through rows)
         for (int j = 0; j < sizeof(x[0])/sizeof(x[0][0]); j++){ // inner loop (iterate through columns in row)
             if(x[i][j] == 1){ // if there is a wall, set mazemap to have a wall
-                MazeMap.x_edges[i][j] = true;
+                MazeMap.setXEdge(j, i, true);
             }
             else{ // if there is no wall, set mazemap to have no wall
-                MazeMap.x_edges[i][j] = false;
+                MazeMap.setXEdge(j, i, false);
             }
         }
     }
@@ -49,10 +49,10 @@ void Maze::generate4x4SampleMaze(){
     for (int i = 0; i < sizeof(y)/sizeof(y[0]); i++){ // outer loop (iterate through rows)
         for (int j = 0; j < sizeof(y[0])/sizeof(y[0][0]); j++){ // inner loop (iterate through columns in row)
             if(y[i][j] == 1){ // if there is a wall, set mazemap to have a wall
-                MazeMap.y_edges[i][j] = true;
+                MazeMap.setYEdge(j, i, true);
             }
             else{ // if there is no wall, set mazemap to have no wall
-                MazeMap.y_edges[i][j] = false;
+                MazeMap.setYEdge(j, i, false);
             }
         }
     }
@@ -78,7 +78,7 @@ void Maze::generate8x8SampleMaze(){
 
     for (int i = 0; i < sizeof(n)/sizeof(n[0]); i++) // passing nodes into graph struct
         for (int j = 0; j < sizeof(n[0])/sizeof(n[0][0]); j++)
-            MazeMap.nodes[i][j] = n[i][j];
+            MazeMap.setNode(j, i, n[i][j]);
     
 
     char x[8][9] = { // marking x edges for maze
@@ -96,10 +96,10 @@ void Maze::generate8x8SampleMaze(){
     for (int i = 0; i < sizeof(x)/sizeof(x[0]); i++){ // outer loop (iterate through rows)
         for (int j = 0; j < sizeof(x[0])/sizeof(x[0][0]); j++){ // inner loop (iterate through columns in row)
             if(x[i][j] == 1){ // if there is a wall, set mazemap to have a wall
-                MazeMap.x_edges[i][j] = true;
+                MazeMap.setXEdge(j, i, true);
             }
             else{ // if there is no wall, set mazemap to have no wall
-                MazeMap.x_edges[i][j] = false;
+                MazeMap.setXEdge(j, i, false);
             }
         }
     }
@@ -120,10 +120,10 @@ void Maze::generate8x8SampleMaze(){
     for (int i = 0; i < sizeof(y)/sizeof(y[0]); i++){ // outer loop (iterate through rows)
         for (int j = 0; j < sizeof(y[0])/sizeof(y[0][0]); j++){ // inner loop (iterate through columns in row)
             if(y[i][j] == 1){ // if there is a wall, set mazemap to have a wall
-                MazeMap.y_edges[i][j] = true;
+                MazeMap.setYEdge(j, i, true);
             }
             else{ // if there is no wall, set mazemap to have no wall
-                MazeMap.y_edges[i][j] = false;
+                MazeMap.setYEdge(j, i, false);
             }
         }
     }
@@ -131,122 +131,53 @@ void Maze::generate8x8SampleMaze(){
 }
 
 void Maze::generateRandomNxNMaze(unsigned int x_size, unsigned int y_size){
-    maze_xsize = x_size;
-    maze_ysize = y_size;
-    
-    MazeMap = GridGraph(x_size,y_size); // allocating GridGraph of specified size
-
-    // need to fill x_edges and y_edges with "true" as a graph with no edges is required
-    for(int i = 0; i < MazeMap.x_edges.size(); i++){
-        for(int j = 0; j < MazeMap.x_edges[i].size(); j++){
-            MazeMap.x_edges[i][j] = true;
-        }
-    }
-
-    for(int i = 0; i < MazeMap.y_edges.size(); i++){
-        for(int j = 0; j < MazeMap.y_edges[i].size(); j++){
-            MazeMap.y_edges[i][j] = true;
-        }
-    }
 
-    const unsigned int num_cells_2_draw = x_size*y_size; // total number of cells which must be visited by cursor before maze is fully mapped
+    std::random_device rd; // non-deterministic number generator used to pick seed
 
-    unsigned int cells_drawn = 0; // count number of cells drawn into maze
+    generateRandomNxNMaze(x_size, y_size, rd());
 
-    Coordinates cursor(0,0); // selecting node 0,0 as cursor starting location
+    return;
+}
 
-    MazeMap.nodes[cursor.y][cursor.x] = 1; // marking starting node as visted
-    cells_drawn++; // incremented starting cell as it has been drawn
+void Maze::generateRandomNxNMaze(unsigned int x_size, unsigned int y_size, unsigned int seed){
 
-    std::random_device rd; // non-deterministic number generator
-    std::mt19937 rand_direction(rd()); // seeding mersenne twister
-    std::uniform_int_distribution<> dist(1,4); // distribute random value between 1 and 4 inclusive
+    generateRandomNxNMaze(x_size, y_size, seed, mg_AldousBroder);
 
-    while(cells_drawn < num_cells_2_draw){
-        
-        Coordinates previous_cell = cursor; // gather previous cell from movement
+    return;
+}
 
-        // first get cell in valid random direction (e.g. choose a cell that is within the allocated grid)
-        int direction = dist(rand_direction); // getting direction to head in x axis (east (0) or west (1))
-        int x_movement;
-        int y_movement;
-        
-        switch(direction){
-            case 1: // north
-            {
-                if((int)previous_cell.y - 1 < 0){ // if north is outside the grid
-                    direction = 2; // set direction to south
-                    y_movement = 1;
-                    cursor.y = previous_cell.y + 1;
-                }
-                else{
-                    y_movement = 0;
-                    cursor.y = previous_cell.y - 1;
-                }
+bool Maze::generateRandomNxNMaze(unsigned int x_size, unsigned int y_size, unsigned int seed, int generator_type){
 
-                break;
-            }
-            case 2: // south
-            {
-                if((int)previous_cell.y + 1 >= maze_ysize){ // if south is outside the grid
-                    direction = 1; // set direction to north
-                    y_movement = 0;
-                    cursor.y = previous_cell.y - 1;
-                }
-                else{
-                    y_movement = 1;
-                    cursor.y = previous_cell.y + 1;
-                }
+    MazeGenerator* Generator = createMazeGenerator(generator_type);
 
-                break;
-            }
-            case 3: // east
-            {
-                if((int)previous_cell.x - 1 < 0){ // if east is outside the grid
-                    direction = 4; // set direction to west
-                    x_movement = 1;
-                    cursor.x = previous_cell.x + 1;
-                }
-                else{
-                    x_movement = 0;
-                    cursor.x = previous_cell.x - 1;
-                }
+    if(Generator == NULL){
+        return false;
+    }
 
-                break;
-            }
-            case 4: // west
-            {
-                if((int)previous_cell.x + 1 >= maze_xsize){ // if west is outside the grid
-                    direction = 4; // set direction to west
-                    x_movement = 0;
-                    cursor.x = previous_cell.x - 1;
-                }
-                else{
-                    x_movement = 1;
-                    cursor.x = previous_cell.x + 1;
-                }
+    maze_xsize = x_size;
+    maze_ysize = y_size;
+    
+    MazeMap = GridGraph(x_size,y_size); // allocating GridGraph of specified size
 
-                break;
-            }
-        }
+    // need to fill x_edges and y_edges with "true" as a graph with no edges is required
+    MazeMap.setAllEdges(true);
 
-        if(MazeMap.nodes[cursor.y][cursor.x] == 0){ // if new neighbour node has not been visited
-                                                     // "draw" cell
+    Generator->generate(&MazeMap, seed);
+    delete Generator;
 
-            MazeMap.nodes[cursor.y][cursor.x] = 1; // mark new node as visited and valid
+    return true;
+}
 
-            if(direction == 1 || direction == 2){ // if moving north or south
-                MazeMap.y_edges[previous_cell.y + y_movement][previous_cell.x] = false; // removing wall
-            }
-            else{ // if moving east or west
-                MazeMap.x_edges[previous_cell.y][previous_cell.x + x_movement] = false; // removing wall
-            }
+bool Maze::loadMazeFile(std::string file_name){
 
-            cells_drawn++; // increment number of cells drawn
-        }
+    if(!readMazeFile(file_name, &MazeMap)){
+        return false;
     }
 
-    return;
+    maze_xsize = MazeMap.getXSize();
+    maze_ysize = MazeMap.getYSize();
+
+    return true;
 }
 
 GridGraph Maze::getMazeMap(){
@@ -286,7 +217,7 @@ bool Maze::printMaze(){ // function to print layout of maze in an intuitive mann
         if(count == 0){ // printing the horizontal walls of maze
 
             for(int j = 0; j < maze_xsize; j++){
-                if(MazeMap.y_edges[i][j]){ // if there is no edge between two nodes
+                if(MazeMap.getYEdge(j, i)){ // if there is no edge between two nodes
                     string_pointer = 1; // print horizontal line
                 }
                 else{ // if there is an edge between two nodes
@@ -301,7 +232,7 @@ bool Maze::printMaze(){ // function to print layout of maze in an intuitive mann
 
             for(int j = 0; j < maze_xsize + 1; j++){
                 
-                if(MazeMap.x_edges[i][j]){ // if there is no edge between two nodes
+                if(MazeMap.getXEdge(j, i)){ // if there is no edge between two nodes
                     string_pointer = 2; // print vetical line
                 }
                 else{ // if there is an edge between two nodes
@@ -0,0 +1,550 @@
+#include "MazeGenerator.h"
+
+#include <fstream>
+#include <algorithm>
+
+// directions used when walking between cells
+#define md_North 0
+#define md_South 1
+#define md_East 2
+#define md_West 3
+
+static bool getNeighbour(const GridGraph* Map, int x, int y, int direction, int* nx, int* ny){ // cell next to x, y in direction, false if it is outside the maze
+
+    *nx = x;
+    *ny = y;
+
+    switch(direction){
+        case md_North:
+            (*ny)--;
+            break;
+        case md_South:
+            (*ny)++;
+            break;
+        case md_East:
+            (*nx)++;
+            break;
+        case md_West:
+            (*nx)--;
+            break;
+    }
+
+    return (*nx >= 0 && *ny >= 0 && *nx < Map->getXSize() && *ny < Map->getYSize());
+}
+
+static void removeWall(GridGraph* Map, int x, int y, int direction){ // removes wall between x, y and its neighbour in direction
+
+    switch(direction){
+        case md_North:
+            Map->setYEdge(x, y, false);
+            break;
+        case md_South:
+            Map->setYEdge(x, y + 1, false);
+            break;
+        case md_East:
+            Map->setXEdge(x + 1, y, false);
+            break;
+        case md_West:
+            Map->setXEdge(x, y, false);
+            break;
+    }
+
+    return;
+}
+
+static void setRowBit(std::vector<uint64_t>* row, int x, bool value){
+
+    uint64_t mask = 1ULL << (x & 63);
+
+    (*row)[x >> 6] = value ? ((*row)[x >> 6] | mask) : ((*row)[x >> 6] & ~mask);
+
+    return;
+}
+
+// ** Aldous-Broder Generator **
+
+void AldousBroderGenerator::generate(GridGraph* Map, unsigned int seed){
+
+    int maze_xsize = Map->getXSize();
+    int maze_ysize = Map->getYSize();
+
+    const unsigned int num_cells_2_draw = maze_xsize*maze_ysize; // total number of cells which must be visited by cursor before maze is fully mapped
+
+    unsigned int cells_drawn = 0; // count number of cells drawn into maze
+
+    Coordinates cursor(0,0); // selecting node 0,0 as cursor starting location
+
+    Map->setNode(cursor.x, cursor.y, 1); // marking starting node as visted
+    cells_drawn++; // incremented starting cell as it has been drawn
+
+    std::mt19937 rand_direction(seed); // seeding mersenne twister
+    std::uniform_int_distribution<> dist(1,4); // distribute random value between 1 and 4 inclusive
+
+    while(cells_drawn < num_cells_2_draw){
+
+        Coordinates previous_cell = cursor; // gather previous cell from movement
+
+        // first get cell in valid random direction (e.g. choose a cell that is within the allocated grid)
+        int direction = dist(rand_direction); // getting direction to head in x axis (east (0) or west (1))
+        int x_movement = 0; // offset from previous cell to edge removed, only the one along direction is used
+        int y_movement = 0;
+
+        switch(direction){
+            case 1: // north
+            {
+                if((int)previous_cell.y - 1 < 0){ // if north is outside the grid
+                    direction = 2; // set direction to south
+                    y_movement = 1;
+                    cursor.y = previous_cell.y + 1;
+                }
+                else{
+                    y_movement = 0;
+                    cursor.y = previous_cell.y - 1;
+                }
+
+                break;
+            }
+            case 2: // south
+            {
+                if((int)previous_cell.y + 1 >= maze_ysize){ // if south is outside the grid
+                    direction = 1; // set direction to north
+                    y_movement = 0;
+                    cursor.y = previous_cell.y - 1;
+                }
+                else{
+                    y_movement = 1;
+                    cursor.y = previous_cell.y + 1;
+                }
+
+                break;
+            }
+            case 3: // east
+            {
+                if((int)previous_cell.x - 1 < 0){ // if east is outside the grid
+                    direction = 4; // set direction to west
+                    x_movement = 1;
+                    cursor.x = previous_cell.x + 1;
+                }
+                else{
+                    x_movement = 0;
+                    cursor.x = previous_cell.x - 1;
+                }
+
+                break;
+            }
+            case 4: // west
+            {
+                if((int)previous_cell.x + 1 >= maze_xsize){ // if west is outside the grid
+                    direction = 3; // set direction to east
+                    x_movement = 0;
+                    cursor.x = previous_cell.x - 1;
+                }
+                else{
+                    x_movement = 1;
+                    cursor.x = previous_cell.x + 1;
+                }
+
+                break;
+            }
+        }
+
+        if(Map->getNode(cursor.x, cursor.y) == 0){ // if new neighbour node has not been visited
+                                                   // "draw" cell
+
+            Map->setNode(cursor.x, cursor.y, 1); // mark new node as visited and valid
+
+            if(direction == 1 || direction == 2){ // if moving north or south
+                Map->setYEdge(previous_cell.x, previous_cell.y + y_movement, false); // removing wall
+            }
+            else{ // if moving east or west
+                Map->setXEdge(previous_cell.x + x_movement, previous_cell.y, false); // removing wall
+            }
+
+            cells_drawn++; // increment number of cells drawn
+        }
+    }
+
+    return;
+}
+
+// ** Wilson Generator **
+
+void WilsonGenerator::generate(GridGraph* Map, unsigned int seed){
+
+    int x_size = Map->getXSize();
+    int y_size = Map->getYSize();
+    int num_of_cells = x_size*y_size;
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<> cell_dist(0, num_of_cells - 1);
+    std::uniform_int_distribution<> direction_dist(0, 3);
+
+    walk_directions.assign(num_of_cells, 0);
+
+    int first_cell = cell_dist(rng); // maze starts from a single random cell
+    Map->setNode(first_cell % x_size, first_cell / x_size, 1);
+
+    for(int start = 0; start < num_of_cells; start++){ // every cell not yet in maze starts a walk
+        int x = start % x_size;
+        int y = start / x_size;
+
+        if(Map->getNode(x, y) == 1){
+            continue;
+        }
+
+        while(Map->getNode(x, y) != 1){ // walking until maze is reached, revisiting a cell overwrites its direction which erases the loop
+            int direction, nx, ny;
+
+            do{
+                direction = direction_dist(rng);
+            } while(!getNeighbour(Map, x, y, direction, &nx, &ny));
+
+            walk_directions[y*x_size + x] = direction;
+            x = nx;
+            y = ny;
+        }
+
+        x = start % x_size;
+        y = start / x_size;
+
+        while(Map->getNode(x, y) != 1){ // carving loop-erased walk into maze
+            int direction = walk_directions[y*x_size + x];
+            int nx, ny;
+
+            getNeighbour(Map, x, y, direction, &nx, &ny);
+
+            Map->setNode(x, y, 1);
+            removeWall(Map, x, y, direction);
+
+            x = nx;
+            y = ny;
+        }
+    }
+
+    return;
+}
+
+// ** Backtracker Generator **
+
+void BacktrackerGenerator::generate(GridGraph* Map, unsigned int seed){
+
+    int x_size = Map->getXSize();
+    int y_size = Map->getYSize();
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<> cell_dist(0, x_size*y_size - 1);
+
+    path.clear();
+
+    int first_cell = cell_dist(rng);
+    Map->setNode(first_cell % x_size, first_cell / x_size, 1);
+    path.push_back(first_cell);
+
+    while(!path.empty()){
+        int x = path.back() % x_size;
+        int y = path.back() / x_size;
+
+        int unvisited[4]; // directions of neighbours which are not yet in maze
+        int num_of_unvisited = 0;
+
+        for(int direction = 0; direction < 4; direction++){
+            int nx, ny;
+
+            if(getNeighbour(Map, x, y, direction, &nx, &ny) && Map->getNode(nx, ny) == 0){
+                unvisited[num_of_unvisited] = direction;
+                num_of_unvisited++;
+            }
+        }
+
+        if(num_of_unvisited == 0){ // dead end, backing up to previous cell
+            path.pop_back();
+            continue;
+        }
+
+        int direction = unvisited[std::uniform_int_distribution<>(0, num_of_unvisited - 1)(rng)];
+        int nx, ny;
+
+        getNeighbour(Map, x, y, direction, &nx, &ny);
+
+        removeWall(Map, x, y, direction);
+        Map->setNode(nx, ny, 1);
+        path.push_back(ny*x_size + nx);
+    }
+
+    return;
+}
+
+// ** Eller Generator **
+
+void EllerGenerator::generate(GridGraph* Map, unsigned int seed){
+
+    generateRows(Map->getXSize(), Map->getYSize(), seed, [Map](int y, const std::vector<uint64_t>& x_edge_row, const std::vector<uint64_t>& y_edge_row){
+        std::copy(x_edge_row.begin(), x_edge_row.end(), Map->getXEdgeRow(y)); // rows are laid out the same as GridGraph rows
+        std::copy(y_edge_row.begin(), y_edge_row.end(), Map->getYEdgeRow(y + 1));
+
+        for(int x = 0; x < Map->getXSize(); x++){
+            Map->setNode(x, y, 1);
+        }
+
+        return true;
+    });
+
+    return;
+}
+
+bool EllerGenerator::generateRows(int x_size, int y_size, unsigned int seed, const MazeRowFunction& writeRow){
+
+    std::mt19937_64 rng(seed);
+
+    int row_words = (x_size + 1 + 63)/64; // same row width as GridGraph
+    std::vector<uint64_t> x_edge_row(row_words);
+    std::vector<uint64_t> y_edge_row(row_words);
+    std::vector<uint64_t> coins(row_words); // one random bit per cell, drawn a word at a time so cells do not each draw a number
+
+    cell_sets.resize(x_size);
+    set_parents.resize(x_size);
+    set_labels.resize(x_size);
+    set_sizes.resize(x_size);
+    set_picks.resize(x_size);
+
+    for(int x = 0; x < x_size; x++){ // every cell of first row starts in its own set
+        cell_sets[x] = x;
+    }
+
+    for(int y = 0; y < y_size; y++){
+        bool last_row = (y == y_size - 1);
+
+        for(int i = 0; i < x_size; i++){
+            set_parents[i] = i;
+        }
+
+        // ~~~ Joining Cells Along Row ~~~
+        for(int w = 0; w < row_words; w++){
+            coins[w] = last_row ? ~0ULL : rng(); // last row joins every set left so the maze is connected
+        }
+
+        std::fill(x_edge_row.begin(), x_edge_row.end(), 0);
+        setRowBit(&x_edge_row, 0, true); // western and eastern borders
+        setRowBit(&x_edge_row, x_size, true);
+
+        int a = findSet(cell_sets[0]); // root of cell to the west, only the root of the eastern set changes when sets are joined
+
+        for(int x = 1; x < x_size; x++){ // x edge between cell x - 1 and cell x
+            int b = findSet(cell_sets[x]);
+            bool join = (a != b) && ((coins[x >> 6] >> (x & 63)) & 1);
+
+            set_parents[b] = join ? a : b;
+            x_edge_row[x >> 6] |= (uint64_t)!join << (x & 63);
+
+            a = join ? a : b;
+        }
+
+        // ~~~ Carving South ~~~
+        if(last_row){ // southern border
+            std::fill(y_edge_row.begin(), y_edge_row.end(), 0);
+
+            for(int x = 0; x < x_size; x++){
+                setRowBit(&y_edge_row, x, true);
+            }
+        }
+        else{
+            for(int w = 0; w < row_words; w++){ // cells carve south at random
+                y_edge_row[w] = rng();
+            }
+            y_edge_row[x_size >> 6] &= (1ULL << (x_size & 63)) - 1; // clearing bits past last cell
+
+            for(int x = 0; x < x_size; x++){
+                cell_sets[x] = findSet(cell_sets[x]);
+                set_sizes[cell_sets[x]] = 0;
+            }
+
+            for(int x = 0; x < x_size; x++){
+                set_sizes[cell_sets[x]]++;
+            }
+
+            for(int x = 0; x < x_size; x++){ // picking a random cell of each set, as a count of cells of the set to skip, once the set is first reached
+                int set = cell_sets[x];
+
+                if(set_sizes[set] > 0){
+                    set_picks[set] = (set_sizes[set] == 1) ? 0 : rng() % set_sizes[set];
+                    set_sizes[set] = 0;
+                }
+            }
+
+            // every set carves south at its pick, then sets of next row are relabelled from 0 so labels never exceed x_size
+            std::fill(set_labels.begin(), set_labels.end(), -1);
+            int next_label = 0;
+
+            for(int x = 0; x < x_size; x++){
+                int set = cell_sets[x];
+
+                set_picks[set]--;
+                if(set_picks[set] == -1){
+                    setRowBit(&y_edge_row, x, false);
+                }
+
+                if((y_edge_row[x >> 6] >> (x & 63)) & 1){ // cell below starts a new set
+                    cell_sets[x] = next_label;
+                    next_label++;
+                }
+                else{
+                    if(set_labels[set] < 0){
+                        set_labels[set] = next_label;
+                        next_label++;
+                    }
+
+                    cell_sets[x] = set_labels[set];
+                }
+            }
+        }
+
+        if(!writeRow(y, x_edge_row, y_edge_row)){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int EllerGenerator::findSet(int set){
+
+    while(set_parents[set] != set){
+        set_parents[set] = set_parents[set_parents[set]]; // halving path to root
+        set = set_parents[set];
+    }
+
+    return set;
+}
+
+// ** Generator Functions **
+
+MazeGenerator* createMazeGenerator(int generator_type){
+
+    switch(generator_type){
+        case mg_AldousBroder:
+            return new AldousBroderGenerator();
+        case mg_Wilson:
+            return new WilsonGenerator();
+        case mg_Backtracker:
+            return new BacktrackerGenerator();
+        case mg_Eller:
+            return new EllerGenerator();
+    }
+
+    return NULL;
+}
+
+static void writeMazeFileHeader(std::ofstream* maze_file, int x_size, int y_size){ // writes header and northern border of a maze file
+
+    MazeFileHeader header = { {'M', 'R', 'M', 'Z'}, MAZE_FILE_VERSION, x_size, y_size };
+    maze_file->write((char*)&header, sizeof(MazeFileHeader));
+
+    std::vector<uint64_t> border_row((x_size + 1 + 63)/64, 0);
+
+    for(int x = 0; x < x_size; x++){
+        setRowBit(&border_row, x, true);
+    }
+
+    maze_file->write((char*)border_row.data(), border_row.size()*sizeof(uint64_t));
+
+    return;
+}
+
+bool writeMazeFile(std::string file_name, const GridGraph* Map){
+
+    std::ofstream maze_file(file_name, std::ios::binary);
+
+    if(!maze_file.is_open()){
+        return false;
+    }
+
+    int row_words = Map->getRowWords();
+
+    writeMazeFileHeader(&maze_file, Map->getXSize(), Map->getYSize());
+
+    for(int y = 0; y < Map->getYSize(); y++){
+        maze_file.write((const char*)Map->getXEdgeRow(y), row_words*sizeof(uint64_t));
+        maze_file.write((const char*)Map->getYEdgeRow(y + 1), row_words*sizeof(uint64_t));
+    }
+
+    return maze_file.good();
+}
+
+bool readMazeFile(std::string file_name, GridGraph* Map){
+
+    std::ifstream maze_file(file_name, std::ios::binary);
+
+    if(!maze_file.is_open()){
+        return false;
+    }
+
+    MazeFileHeader header;
+    maze_file.read((char*)&header, sizeof(MazeFileHeader));
+
+    if(!maze_file.good() || std::string(header.magic, 4) != "MRMZ" || header.version != MAZE_FILE_VERSION || header.x_size < 1 || header.y_size < 1){
+        return false;
+    }
+
+    GridGraph Loaded_Map(header.x_size, header.y_size);
+    int row_words = Loaded_Map.getRowWords();
+
+    std::vector<uint64_t> node_row(row_words, 0); // every node of a maze file is part of the maze
+    for(int x = 0; x < header.x_size; x++){
+        setRowBit(&node_row, x, true);
+    }
+
+    maze_file.read((char*)Loaded_Map.getYEdgeRow(0), row_words*sizeof(uint64_t));
+
+    for(int y = 0; y < header.y_size; y++){ // rows are read straight into the planes of Loaded_Map
+        maze_file.read((char*)Loaded_Map.getXEdgeRow(y), row_words*sizeof(uint64_t));
+        maze_file.read((char*)Loaded_Map.getYEdgeRow(y + 1), row_words*sizeof(uint64_t));
+
+        std::copy(node_row.begin(), node_row.end(), Loaded_Map.getNodeLowRow(y));
+    }
+
+    if(!maze_file.good()){ // file ended before every row was read
+        return false;
+    }
+
+    *Map = std::move(Loaded_Map);
+
+    return true;
+}
+
+bool generateMazeFile(std::string file_name, int x_size, int y_size, unsigned int seed, int generator_type){
+
+    if(generator_type != mg_Eller){ // only Eller's algorithm can generate a row without knowing the rows after it
+        MazeGenerator* Generator = createMazeGenerator(generator_type);
+
+        if(Generator == NULL){
+            return false;
+        }
+
+        GridGraph Map(x_size, y_size);
+        Map.setAllEdges(true);
+
+        Generator->generate(&Map, seed);
+        delete Generator;
+
+        return writeMazeFile(file_name, &Map);
+    }
+
+    std::ofstream maze_file(file_name, std::ios::binary);
+
+    if(!maze_file.is_open()){
+        return false;
+    }
+
+    writeMazeFileHeader(&maze_file, x_size, y_size);
+
+    EllerGenerator Generator;
+
+    Generator.generateRows(x_size, y_size, seed, [&maze_file](int, const std::vector<uint64_t>& x_edge_row, const std::vector<uint64_t>& y_edge_row){
+        maze_file.write((const char*)x_edge_row.data(), x_edge_row.size()*sizeof(uint64_t));
+        maze_file.write((const char*)y_edge_row.data(), y_edge_row.size()*sizeof(uint64_t));
+
+        return maze_file.good(); // stopping once disk is full
+    });
+
+    return maze_file.good();
+}
@@ -0,0 +1,15 @@
+#include "MessagePool.h"
+
+#include <atomic>
+
+static std::atomic<unsigned long> message_system_allocations(0); // shared by every simulation running at once
+
+void countMessageSystemAllocation(){
+    message_system_allocations.fetch_add(1, std::memory_order_relaxed); // only the total is read, no ordering with other memory is needed
+
+    return;
+}
+
+unsigned long getMessageSystemAllocations(){
+    return message_system_allocations.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,112 @@
+#include "PathPlanner.h"
+
+PathPlanner* createPathPlanner(int planner_type){ // allocates a planner of a specified type
+
+    switch(planner_type){
+        case pp_BFS:
+            return new BFSPlanner();
+        case pp_AStar:
+            return new AStarPlanner();
+        default:
+            throw "Critical Error: Invalid path planner type";
+    }
+}
+
+bool BFSPlanner::planPath(PathfindingWorkspace* W, Coordinates start, Coordinates destination, const NeighbourFunction& getNeighbours){
+
+    nodes_expanded = 0;
+
+    W->beginSearch(); // invalidating visited nodes and queue of any previous search
+
+    int start_index = W->toIndex(start);
+    int dest_index = W->toIndex(destination);
+
+    W->push(start_index); // adding first node to explore to node queue
+    W->visit(start_index, start_index); // marking first node as visited using itself as parent
+
+    while(!W->queueEmpty()){// while nodes to explore are in node_queue
+        
+        int curr_index = W->front(); // gathering node from front of queue
+
+        W->pop(); // removing node from front of the queue
+
+        if(curr_index == dest_index){ // if the target node has been located
+            return true;
+        }
+
+        nodes_expanded++;
+
+        Coordinates curr_node = W->toCoordinates(curr_index);
+        std::vector<Coordinates> valid_neighbours = getNeighbours(curr_node.x, curr_node.y); // gathering neighbours of current node
+
+        for(int i = 0; i < valid_neighbours.size(); i++){ // iterate through all of the current node's neighbours to see if they have been explored
+            
+            int neighbour_index = W->toIndex(valid_neighbours[i]);
+
+            if(!W->isVisited(neighbour_index)){ // if neighbour has not been visited
+                W->push(neighbour_index); // add to node_queue and visited nodes
+                W->visit(neighbour_index, curr_index); 
+            }
+        }
+    }
+
+    return false; // destination could not be reached
+}
+
+bool AStarPlanner::planPath(PathfindingWorkspace* W, Coordinates start, Coordinates destination, const NeighbourFunction& getNeighbours){
+
+    nodes_expanded = 0;
+
+    W->beginSearch(); // invalidating visited nodes of any previous search
+                      // a node is visited once it has been discovered, its best known distance from start is stored alongside it
+
+    open_set.clear();
+
+    int start_index = W->toIndex(start);
+    int dest_index = W->toIndex(destination);
+
+    int h = abs(start.x - destination.x) + abs(start.y - destination.y); // manhattan distance to destination
+
+    W->visit(start_index, start_index); // marking first node as visited using itself as parent
+    W->setDistance(start_index, 0);
+
+    open_set.push_back({h, h, 0, start_index});
+
+    while(!open_set.empty()){ // while nodes remain in the open set
+
+        std::pop_heap(open_set.begin(), open_set.end(), HeapCompare()); // moving node with lowest f to back of heap
+        HeapEntry curr = open_set.back();
+        open_set.pop_back();
+
+        if(curr.g != W->getDistance(curr.index)){ // entry is stale as a shorter path to the node was found after it was pushed
+            continue;
+        }
+
+        if(curr.index == dest_index){ // if the target node has been located
+            return true;
+        }
+
+        nodes_expanded++;
+
+        Coordinates curr_node = W->toCoordinates(curr.index);
+        std::vector<Coordinates> valid_neighbours = getNeighbours(curr_node.x, curr_node.y); // gathering neighbours of current node
+
+        for(int i = 0; i < valid_neighbours.size(); i++){
+
+            int neighbour_index = W->toIndex(valid_neighbours[i]);
+            int g = curr.g + 1; // distance to neighbour through current node
+
+            if(!W->isVisited(neighbour_index) || g < W->getDistance(neighbour_index)){ // if neighbour is new or a shorter path to it has been found
+                W->visit(neighbour_index, curr.index);
+                W->setDistance(neighbour_index, g);
+
+                h = abs(valid_neighbours[i].x - destination.x) + abs(valid_neighbours[i].y - destination.y);
+
+                open_set.push_back({g + h, h, g, neighbour_index});
+                std::push_heap(open_set.begin(), open_set.end(), HeapCompare());
+            }
+        }
+    }
+
+    return false; // destination could not be reached
+}
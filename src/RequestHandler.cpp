@@ -1,48 +1,320 @@
 #include "RequestHandler.h"
 
+static std::vector<RequestHandler::MessageChannel*> free_channels; // channels of destroyed handlers, shared by every simulation running at once
+static pthread_mutex_t free_channels_lock = PTHREAD_MUTEX_INITIALIZER; // only taken when a handler is created or destroyed or a channel is opened
+
+RequestHandler::MessageChannel::MessageChannel(){
+    tail_segment = new MessageSegment; // channel starts with a single segment
+    tail_segment->next_segment.store(NULL, std::memory_order_relaxed);
+    first_segment = tail_segment;
+
+    payloads.resize(MESSAGE_PAYLOAD_CAPACITY);
+    sent_payloads.resize(MESSAGE_PAYLOAD_CAPACITY);
+
+    reset();
+}
+
+void RequestHandler::MessageChannel::reset(){
+    head.store(0, std::memory_order_relaxed);
+    head_segment.store(tail_segment, std::memory_order_relaxed); // first message is held by last segment, segments before it can be reused
+    payloads_released.store(0, std::memory_order_relaxed);
+    payloads_held = 0;
+
+    tail.store(0, std::memory_order_relaxed);
+    payloads_sent = 0;
+    payloads_reclaimed = 0;
+
+    free_payloads.clear();
+
+    for(int i = payloads.size() - 1; i >= 0; i--){ // every payload is free, first payload on top
+        free_payloads.push_back(i);
+    }
+
+    next_channel = NULL;
+
+    return;
+}
+
 RequestHandler::RequestHandler(){
-    pthread_mutex_init(&msg_mutex, NULL); // intialzing msg_mutex
-                                          // TODO: add checks for if mutex is initialized properly
+    default_channel = newChannel();
+    last_channel = default_channel;
+    next_channel_to_read = default_channel;
+    num_of_channels = 1;
+
+    num_of_messages.store(0);
+}
+
+RequestHandler::~RequestHandler(){ // all threads must have stopped using handler before it is destroyed
+    MessageChannel* channel = default_channel;
+
+    while(channel != NULL){ // returning every channel to pool
+        MessageChannel* next_channel = channel->next_channel;
+        freeChannel(channel);
+        channel = next_channel;
+    }
+}
+
+RequestHandler::MessageChannel* RequestHandler::openChannel(){
+
+    MessageChannel* channel = newChannel();
+
+    last_channel->next_channel = channel; // adding channel to end of list so channels are read in the order they were opened
+    last_channel = channel;
+    num_of_channels++;
+
+    return channel;
+}
+
+MessagePayload* RequestHandler::getPayload(){
+    return getPayload(default_channel);
+}
+
+MessagePayload* RequestHandler::getPayload(MessageChannel* channel){
+
+    unsigned long payloads_released = channel->payloads_released.load(std::memory_order_acquire); // receiver has finished reading payloads released before this point
+
+    while(channel->payloads_reclaimed < payloads_released){ // payloads are released in the order they were sent, so the last one reclaimed is the most recently released
+        channel->free_payloads.push_back(channel->sent_payloads[channel->payloads_reclaimed % channel->sent_payloads.size()]);
+        channel->payloads_reclaimed++;
+    }
+
+    if(channel->free_payloads.empty()){ // receiver still holds every payload, adding one rather than making sender wait
+        int num_of_payloads = channel->payloads.size();
+
+        std::vector<int> sent_payloads(num_of_payloads + 1); // every payload is waiting to be released, keeping them in the order they were sent
+
+        for(unsigned long i = channel->payloads_reclaimed; i < channel->payloads_sent; i++){
+            sent_payloads[i % sent_payloads.size()] = channel->sent_payloads[i % num_of_payloads];
+        }
+
+        channel->sent_payloads = std::move(sent_payloads);
+        channel->payloads.emplace_back(); // deque keeps payloads receiver is reading in place
+        channel->free_payloads.push_back(num_of_payloads);
+
+        countMessageSystemAllocation();
+    }
+
+    MessagePayload* payload = &channel->payloads[channel->free_payloads.back()];
+    payload->clear(); // memory is kept for sender to fill
+
+    return payload;
 }
 
-RequestHandler::~RequestHandler(){
-    pthread_mutex_destroy(&msg_mutex); // destroy message mutex as no longer needed
+void RequestHandler::sendMessage(Message m){
+    sendMessage(std::move(m), default_channel);
+
+    return;
 }
 
-void RequestHandler::sendMessage(Message* m){ // TODO: add basic message layout validation
-    pthread_mutex_lock(&msg_mutex); // locking mutex so msg_queue can be modified safely 
+void RequestHandler::sendMessage(Message m, MessageChannel* channel){
 
-    msg_queue.push(m); // add m to end of FIFO msg_queue
+    pushMessage(channel, &m); // add m to end of sender's FIFO channel
 
-    pthread_mutex_unlock(&msg_mutex);// unlocking mutex so msg_queue can be modified by other threads 
+    num_of_messages.fetch_add(1, std::memory_order_release); // message is counted once it can be received
 
     return;
 }
 
-Message* RequestHandler::getMessage(){
-    Message* temp;
+void RequestHandler::sendBatch(std::vector<Message>* messages, MessageChannel* channel){
+
+    if(messages->empty()){
+        return;
+    }
+
+    for(int i = 0; i < messages->size(); i++){
+        pushMessage(channel, &(*messages)[i]);
+    }
+
+    num_of_messages.fetch_add(messages->size(), std::memory_order_release); // every message is counted once they can all be received
+
+    messages->clear(); // moved from messages no longer hold any data
+
+    return;
+}
+
+bool RequestHandler::getMessage(Message* m){
+
+    releasePayloads(); // payloads of previous message are no longer needed
+
+    if(num_of_messages.load(std::memory_order_acquire) <= 0){ // no need to visit channels if nothing has been sent
+        return false;
+    }
+
+    MessageChannel* channel = next_channel_to_read;
+
+    do{ // visiting each channel once, starting from where last message was taken
+        if(popMessage(channel, m)){ // message moved from front of channel
+            next_channel_to_read = nextChannel(channel); // next message is taken from the following channel so no sender is starved
+            num_of_messages.fetch_sub(1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        channel = nextChannel(channel);
+    } while(channel != next_channel_to_read);
+
+    return false;
+}
+
+int RequestHandler::drainAll(std::vector<Message>* messages, unsigned int first_channel){
+
+    int num_to_drain = num_of_messages.load(std::memory_order_acquire); // messages sent after this point are left for the next drain
+    int num_drained = 0;
 
-    pthread_mutex_lock(&msg_mutex); // locking mutex so msg_queue can be accessed and modified safely 
-    
-    if(msg_queue.size() > 0){
-        temp = msg_queue.front(); // gathering msg from front of msg_queue
-        msg_queue.pop(); // removing front of msg_queue
+    Message m;
+
+    releasePayloads(); // payloads of previous batch are no longer needed
+
+    if(num_to_drain <= 0){ // no need to visit channels if nothing has been sent
+        return 0;
     }
-    else{
-        temp = NULL;
+
+    MessageChannel* start_channel = default_channel;
+
+    for(unsigned int i = first_channel % num_of_channels; i > 0; i--){ // start depends only on first_channel so skipping a drain never changes the order of later ones
+        start_channel = start_channel->next_channel;
     }
 
-    pthread_mutex_unlock(&msg_mutex);// unlocking mutex so msg_queue can be modified by other threads 
+    MessageChannel* channel = start_channel;
+
+    do{ // emptying each channel in turn, starting from start_channel
+        while(num_drained < num_to_drain && popMessage(channel, &m)){
+            messages->push_back(std::move(m));
+            num_drained++;
+        }
+
+        channel = nextChannel(channel);
+    } while(channel != start_channel && num_drained < num_to_drain);
+
+    if(num_drained > 0){
+        num_of_messages.fetch_sub(num_drained, std::memory_order_relaxed); // whole batch is removed from count at once
+    }
 
-    return temp; // returning message from front of queue
+    return num_drained;
 }
 
 int RequestHandler::getNumberofMessages(){
-    pthread_mutex_lock(&msg_mutex); // locking mutex so msg_queue can be modified safely 
+    return num_of_messages.load(std::memory_order_acquire);
+}
+
+RequestHandler::MessageChannel* RequestHandler::nextChannel(MessageChannel* channel){ // channel after channel, wrapping around to the first channel
+
+    if(channel->next_channel == NULL){
+        return default_channel;
+    }
+
+    return channel->next_channel;
+}
+
+void RequestHandler::pushMessage(MessageChannel* channel, Message* m){ // moves message to back of channel
+
+    unsigned long tail = channel->tail.load(std::memory_order_relaxed);
+
+    if(tail % MESSAGE_RING_CAPACITY == 0 && tail != 0){ // last segment is full, adding a segment to end of list
+        MessageSegment* segment;
+
+        if(channel->first_segment != channel->head_segment.load(std::memory_order_acquire)){ // receiver has taken every message of first segment
+            segment = channel->first_segment;
+            channel->first_segment = segment->next_segment.load(std::memory_order_relaxed);
+        }
+        else{ // receiver has not kept up with sender
+            segment = new MessageSegment;
+            countMessageSystemAllocation();
+        }
+
+        segment->next_segment.store(NULL, std::memory_order_relaxed);
+        channel->tail_segment->next_segment.store(segment, std::memory_order_release); // receiver sees segment before it sees any message in it
+        channel->tail_segment = segment;
+    }
+
+    if(m->Payload != NULL){ // payload is in use until receiver releases it
+        if(channel->free_payloads.empty() || m->Payload != &channel->payloads[channel->free_payloads.back()]){
+            throw "Critical Error: Message payload was not taken from its channel";
+        }
+
+        channel->sent_payloads[channel->payloads_sent % channel->sent_payloads.size()] = channel->free_payloads.back();
+        channel->free_payloads.pop_back();
+        channel->payloads_sent++;
+    }
+
+    channel->tail_segment->slots[tail & (MESSAGE_RING_CAPACITY - 1)] = std::move(*m);
+    channel->tail.store(tail + 1, std::memory_order_release); // publishing message to receiver
+
+    return;
+}
+
+bool RequestHandler::popMessage(MessageChannel* channel, Message* m){ // moves message from front of channel into m, false if channel is empty
+
+    unsigned long head = channel->head.load(std::memory_order_relaxed);
+
+    if(head == channel->tail.load(std::memory_order_acquire)){ // channel is empty
+        return false;
+    }
 
-    int queue_size = msg_queue.size(); // get queue size
+    MessageSegment* segment = channel->head_segment.load(std::memory_order_relaxed);
 
-    pthread_mutex_unlock(&msg_mutex);// unlocking mutex so msg_queue can be modified by other threads 
+    if(head % MESSAGE_RING_CAPACITY == 0 && head != 0){ // every message of segment has been taken, moving to next segment
+        segment = segment->next_segment.load(std::memory_order_acquire);
+        channel->head_segment.store(segment, std::memory_order_release); // segment left behind can be reused by sender
+    }
+
+    *m = std::move(segment->slots[head & (MESSAGE_RING_CAPACITY - 1)]);
+
+    if(m->Payload != NULL){ // payload is read in place, so it is held until the next getMessage or drainAll
+        if(channel->payloads_held == 0){
+            channels_holding_payloads.push_back(channel);
+        }
+
+        channel->payloads_held++;
+    }
+
+    channel->head.store(head + 1, std::memory_order_release); // freeing slot for sender
+
+    return true;
+}
+
+void RequestHandler::releasePayloads(){ // returns payloads of messages received since last getMessage or drainAll to their channels
+
+    for(int i = 0; i < channels_holding_payloads.size(); i++){
+        MessageChannel* channel = channels_holding_payloads[i];
+
+        channel->payloads_released.store(channel->payloads_released.load(std::memory_order_relaxed) + channel->payloads_held, std::memory_order_release); // only receiver writes payloads_released
+        channel->payloads_held = 0;
+    }
+
+    channels_holding_payloads.clear();
+
+    return;
+}
 
-    return queue_size;
-}
\ No newline at end of file
+RequestHandler::MessageChannel* RequestHandler::newChannel(){
+
+    MessageChannel* channel = NULL;
+
+    pthread_mutex_lock(&free_channels_lock);
+
+    if(!free_channels.empty()){
+        channel = free_channels.back();
+        free_channels.pop_back();
+    }
+
+    pthread_mutex_unlock(&free_channels_lock);
+
+    if(channel == NULL){ // no channel left by a previous handler
+        channel = new MessageChannel;
+        countMessageSystemAllocation();
+    }
+
+    return channel;
+}
+
+void RequestHandler::freeChannel(MessageChannel* channel){
+
+    channel->reset();
+
+    pthread_mutex_lock(&free_channels_lock);
+    free_channels.push_back(channel);
+    pthread_mutex_unlock(&free_channels_lock);
+
+    return;
+}
@@ -0,0 +1,476 @@
+#include "RequestTrace.h"
+
+// ** RequestTrace Constructors **
+
+RequestTrace::RequestTrace(){
+    records.reserve(64); // enough for most turns of a small swarm, grows with larger swarms
+    paths.reserve(256);
+}
+
+// ** Record Functions **
+
+void RequestTrace::addRequest(const MessageData& request, const MessagePayload* request_payload, const MessageData* response, const MessagePayload* response_payload, unsigned int transaction_id){
+
+    TraceRecord record = {}; // unused fields are left as 0
+
+    record.transaction = transaction_id;
+    record.type = getRequestType(request);
+
+    switch(getRequestType(request)){ // gathering request information held by message
+        case shutDownRequest_ID:
+        {
+            const m_shutDownRequest* request_cast = &std::get<m_shutDownRequest>(request);
+
+            record.robot_id = request_cast->robot_id;
+            break;
+        }
+        case addRobotRequest_ID:
+        {
+            const m_addRobotRequest* request_cast = &std::get<m_addRobotRequest>(request);
+
+            record.current_x = request_cast->x;
+            record.current_y = request_cast->y;
+            break;
+        }
+        case updateGlobalMapRequest_ID:
+        {
+            const m_updateGlobalMapRequest* request_cast = &std::get<m_updateGlobalMapRequest>(request);
+
+            record.robot_id = request_cast->robot_id;
+            record.current_x = request_cast->cords.x;
+            record.current_y = request_cast->cords.y;
+
+            if(request_cast->wall_info[0]) // if there is a wall to the north
+                record.walls |= tw_North;
+
+            if(request_cast->wall_info[1]) // if there is a wall to the south
+                record.walls |= tw_South;
+
+            if(request_cast->wall_info[2]) // if there is a wall to the east
+                record.walls |= tw_East;
+
+            if(request_cast->wall_info[3]) // if there is a wall to the west
+                record.walls |= tw_West;
+
+            break;
+        }
+        case move2CellRequest_ID:
+        {
+            const m_move2CellRequest* request_cast = &std::get<m_move2CellRequest>(request);
+
+            record.robot_id = request_cast->robot_id;
+            record.target_x = request_cast->target_cell.x;
+            record.target_y = request_cast->target_cell.y;
+            break;
+        }
+        case reserveCellRequest_ID:
+        {
+            const m_reserveCellRequest* request_cast = &std::get<m_reserveCellRequest>(request);
+
+            record.robot_id = request_cast->robot_id;
+            addPath(request_payload->path, &record);
+            break;
+        }
+        case updateRobotLocationRequest_ID:
+        {
+            const m_updateRobotLocationRequest* request_cast = &std::get<m_updateRobotLocationRequest>(request);
+
+            record.robot_id = request_cast->robot_id;
+            record.current_x = request_cast->new_robot_location.x;
+            record.current_y = request_cast->new_robot_location.y;
+            break;
+        }
+        case getMapRequest_ID:
+        {
+            const m_getMapRequest* request_cast = &std::get<m_getMapRequest>(request);
+
+            record.robot_id = request_cast->robot_id;
+            record.current_x = request_cast->current_cell.x;
+            record.current_y = request_cast->current_cell.y;
+            record.target_x = request_cast->target_cell.x;
+            record.target_y = request_cast->target_cell.y;
+            break;
+        }
+        case getFrontierTargetRequest_ID:
+        {
+            const m_getFrontierTargetRequest* request_cast = &std::get<m_getFrontierTargetRequest>(request);
+
+            record.robot_id = request_cast->robot_id;
+            record.current_x = request_cast->current_cell.x;
+            record.current_y = request_cast->current_cell.y;
+            break;
+        }
+    }
+
+    if(response != NULL){
+        record.flags |= tf_Has_Response;
+
+        switch(getRequestType(*response)){ // gathering response information held by message, only responses carrying data are recorded
+            case addRobotRequest_ID:
+            {
+                record.robot_id = std::get<m_addRobotResponse>(*response).robot_id;
+                break;
+            }
+            case move2CellRequest_ID:
+            {
+                if(std::get<m_move2CellResponse>(*response).can_movement_occur)
+                    record.flags |= tf_Result;
+
+                break;
+            }
+            case reserveCellRequest_ID:
+            {
+                if(std::get<m_reserveCellResponse>(*response).cell_reserved)
+                    record.flags |= tf_Result;
+
+                break;
+            }
+            case getFrontierTargetRequest_ID:
+            {
+                if(std::get<m_getFrontierTargetResponse>(*response).target_found)
+                    record.flags |= tf_Result;
+
+                addPath(response_payload->path, &record);
+                break;
+            }
+        }
+    }
+
+    records.push_back(record);
+
+    return;
+}
+
+void RequestTrace::addRecord(const TraceRecord& record, const std::vector<Coordinates>* path){
+
+    records.push_back(record);
+
+    for(int i = 0; i < path->size(); i++){
+        paths.push_back((*path)[i].x);
+        paths.push_back((*path)[i].y);
+    }
+
+    return;
+}
+
+void RequestTrace::addPath(const MessageVector<Coordinates>& path, TraceRecord* record){
+
+    for(int i = 0; i < path.size(); i++){
+        paths.push_back(path[i].x);
+        paths.push_back(path[i].y);
+    }
+
+    record->path_length = path.size();
+
+    return;
+}
+
+void RequestTrace::clear(){
+
+    records.clear(); // capacity is kept for the next turn
+    paths.clear();
+
+    return;
+}
+
+void RequestTrace::swap(RequestTrace* other){
+
+    records.swap(other->records);
+    paths.swap(other->paths);
+
+    return;
+}
+
+void RequestTrace::setTurn(unsigned int turn){
+
+    for(int i = 0; i < records.size(); i++){
+        records[i].turn = turn;
+    }
+
+    return;
+}
+
+// ** Conversion Functions **
+
+json RequestTrace::toJSON(){ // key names and value types match those RobotMaster exported before traces were recorded as TraceRecords
+
+    json transactions = json::array();
+
+    int path_index = 0; // index in paths of current record's path
+
+    for(int i = 0; i < records.size(); i++){
+        const TraceRecord* record = &records[i];
+
+        json request_buffer_json, response_buffer_json;
+
+        json path_json; // path of record as [x, y] pairs, left null if record has no path
+        for(int j = 0; j < record->path_length; j++){
+            path_json.push_back({ paths[path_index], paths[path_index + 1] });
+            path_index += 2;
+        }
+
+        bool has_response = record->flags & tf_Has_Response;
+        std::string result = (record->flags & tf_Result) ? "y" : "n";
+
+        switch(record->type){
+            case shutDownRequest_ID:
+            {
+                request_buffer_json["ID"] = record->robot_id;
+                break;
+            }
+            case addRobotRequest_ID:
+            {
+                request_buffer_json["x_pos"] = record->current_x;
+                request_buffer_json["y_pos"] = record->current_y;
+
+                if(has_response)
+                    response_buffer_json["Assigned_ID"] = record->robot_id;
+
+                break;
+            }
+            case updateGlobalMapRequest_ID:
+            {
+                request_buffer_json["ID"] = record->robot_id;
+
+                request_buffer_json["Current_Cell"] = { {"x_pos", record->current_x},
+                                                        {"y_pos", record->current_y} };
+
+                request_buffer_json["Wall_Info"] = { {"North", (record->walls & tw_North) ? "y" : "n"},
+                                                     {"South", (record->walls & tw_South) ? "y" : "n"},
+                                                     {"East", (record->walls & tw_East) ? "y" : "n"},
+                                                     {"West", (record->walls & tw_West) ? "y" : "n"} };
+                break;
+            }
+            case move2CellRequest_ID:
+            {
+                request_buffer_json["ID"] = record->robot_id;
+
+                request_buffer_json["Target_Cell"] = { { "x_pos", record->target_x},
+                                                       { "y_pos", record->target_y} };
+
+                if(has_response){
+                    char movement_occured = (record->flags & tf_Result) ? 'y' : 'n';
+                    response_buffer_json["Movement_Occured"] = movement_occured; // exported as a char, which json stores as its character code
+                }
+
+                break;
+            }
+            case reserveCellRequest_ID:
+            {
+                request_buffer_json["ID"] = record->robot_id;
+
+                if(record->path_length > 0)
+                    request_buffer_json["Target_Cell"] = std::move(path_json);
+
+                if(has_response)
+                    response_buffer_json["Cell_Reserved"] = result;
+
+                break;
+            }
+            case updateRobotLocationRequest_ID:
+            {
+                request_buffer_json["ID"] = record->robot_id;
+
+                request_buffer_json["Current_Cell"] = { { "x_pos", record->current_x},
+                                                        { "y_pos", record->current_y} };
+                break;
+            }
+            case getMapRequest_ID:
+            {
+                request_buffer_json["ID"] = record->robot_id;
+
+                request_buffer_json["Current_Cell"] = { { "x_pos", record->current_x},
+                                                        { "y_pos", record->current_y} };
+
+                request_buffer_json["Target_Cell"] = { { "x_pos", record->target_x},
+                                                       { "y_pos", record->target_y} };
+                break;
+            }
+            case getFrontierTargetRequest_ID:
+            {
+                request_buffer_json["ID"] = record->robot_id;
+
+                request_buffer_json["Current_Cell"] = { { "x_pos", record->current_x},
+                                                        { "y_pos", record->current_y} };
+
+                if(has_response){
+                    response_buffer_json["Cell_Reserved"] = result;
+
+                    if(record->path_length > 0)
+                        response_buffer_json["Target_Cell"] = std::move(path_json);
+                }
+
+                break;
+            }
+        }
+
+        json request_json;
+        request_json["Type"] = (int)record->type;
+        request_json["Request"] = std::move(request_buffer_json);
+        request_json["Response"] = std::move(response_buffer_json);
+        request_json["Transaction"] = record->transaction;
+
+        transactions.push_back(std::move(request_json));
+    }
+
+    return transactions;
+}
+
+// ** RequestTraceReader Constructors **
+
+RequestTraceReader::RequestTraceReader(std::string trace_directory): requests_stream(trace_directory + TRACE_REQUESTS_FILE, std::ios::binary), paths_stream(trace_directory + TRACE_PATHS_FILE, std::ios::binary){
+
+    trace_open = false;
+    has_next_record = false;
+    number_of_turns = 0;
+
+    if(!requests_stream.is_open() || !paths_stream.is_open()){
+        return;
+    }
+
+    TraceHeader header;
+    requests_stream.read((char*)&header, sizeof(TraceHeader));
+
+    if(requests_stream.gcount() != sizeof(TraceHeader) || strncmp(header.magic, "MRTR", 4) != 0 || header.version != TRACE_VERSION || header.record_size != sizeof(TraceRecord)){
+        return;
+    }
+
+    number_of_turns = header.number_of_turns;
+
+    std::ifstream info_stream(trace_directory + TRACE_INFO_FILE);
+    if(info_stream.is_open()){
+        info = json::parse(info_stream);
+    }
+
+    trace_open = true;
+}
+
+// ** Read Functions **
+
+bool RequestTraceReader::readRecord(TraceRecord* record, std::vector<Coordinates>* path){
+
+    if(!trace_open){
+        return false;
+    }
+
+    requests_stream.read((char*)record, sizeof(TraceRecord));
+
+    if(requests_stream.gcount() != sizeof(TraceRecord)){ // every record has been read
+        return false;
+    }
+
+    path->resize(record->path_length);
+
+    for(int i = 0; i < record->path_length; i++){
+        int32_t cell[2];
+        paths_stream.read((char*)cell, sizeof(cell));
+
+        (*path)[i] = Coordinates(cell[0], cell[1]);
+    }
+
+    return true;
+}
+
+void RequestTraceReader::readTurn(unsigned int turn, RequestTrace* turn_trace){
+
+    turn_trace->clear();
+
+    if(!has_next_record){
+        has_next_record = readRecord(&next_record, &next_path);
+    }
+
+    while(has_next_record && next_record.turn <= turn){
+        turn_trace->addRecord(next_record, &next_path);
+
+        has_next_record = readRecord(&next_record, &next_path);
+    }
+
+    return;
+}
+
+// ** Trace Conversion Functions **
+
+static void writeIndented(std::ofstream* stream, const json& value, int indent){ // writes value with an indent of 4, every line after the first is shifted by indent spaces
+
+    std::string dumped = value.dump(4);
+    std::string padding(indent, ' ');
+
+    for(int i = 0; i < dumped.size(); i++){
+        stream->put(dumped[i]);
+
+        if(dumped[i] == '\n'){ // newlines within strings are escaped so every newline starts a new line of output
+            *stream << padding;
+        }
+    }
+
+    return;
+}
+
+bool convertTraceToJSON(std::string trace_directory, std::string json_file){
+
+    RequestTraceReader Reader(trace_directory);
+
+    if(!Reader.isOpen()){
+        return false;
+    }
+
+    json summary = Reader.getInfo();
+
+    if(!summary.is_object()){ // trace was not closed
+        return false;
+    }
+
+    std::ofstream json_stream(json_file);
+
+    if(!json_stream.is_open()){
+        return false;
+    }
+
+    // writing keys in sorted order, same as nlohmann json orders them, with turns streamed into "Simulation"
+    json_stream << "{";
+
+    bool simulation_written = false;
+    bool first_key = true;
+
+    auto writeSimulation = [&](){
+        json_stream << (first_key ? "\n" : ",\n") << "    \"Simulation\": [";
+
+        RequestTrace turn_trace;
+        bool request_handled = false; // turns are null until RobotMaster has handled its first request, empty arrays after
+
+        for(unsigned int turn = 1; turn <= Reader.getNumberofTurns(); turn++){
+            Reader.readTurn(turn, &turn_trace);
+
+            request_handled = request_handled || !turn_trace.isEmpty();
+
+            json turn_json;
+            turn_json["Turn_" + std::to_string(turn)] = request_handled ? turn_trace.toJSON() : json();
+
+            json_stream << (turn == 1 ? "\n        " : ",\n        ");
+            writeIndented(&json_stream, turn_json, 8);
+        }
+
+        json_stream << (Reader.getNumberofTurns() == 0 ? "]" : "\n    ]");
+
+        simulation_written = true;
+        first_key = false;
+    };
+
+    for(auto item = summary.begin(); item != summary.end(); item++){
+        if(!simulation_written && item.key() > "Simulation"){
+            writeSimulation();
+        }
+
+        json_stream << (first_key ? "\n    " : ",\n    ") << json(item.key()).dump() << ": ";
+        writeIndented(&json_stream, item.value(), 4);
+        first_key = false;
+    }
+
+    if(!simulation_written){
+        writeSimulation();
+    }
+
+    json_stream << "\n}" << std::endl;
+
+    return true;
+}
@@ -11,11 +11,20 @@ Robot::Robot(int x, int y, unsigned int xsize, unsigned int ysize){ // construct
     number_of_unexplored = 1; // set unknown cells to 1 as current occupied cell is unknown to robot
  
     LocalMap = new GridGraph(xsize,ysize); // allocating local map to be size of maze
+
+    Workspace = PathfindingWorkspace(xsize,ysize); // allocating pathfinding workspace to be size of maze
+
+    Planner = createPathPlanner(pp_AStar); // targets are known so A* is used by default
+
+    frontier_search_mode = fs_IncrementalBFS; // nearest unknown cell searches are resumed where possible by default
+    FrontierSearch = PathfindingWorkspace(xsize,ysize);
+    frontier_search_valid = false; // no search has occured yet
     
 }
 
 Robot::~Robot(){
     delete LocalMap; // deleting LocalMap as it was dynamically allocated
+    delete Planner;
 }
 
 std::vector<bool> Robot::scanCell(GridGraph* maze){ // scans current cell for walls on all sides
@@ -25,43 +34,48 @@ std::vector<bool> Robot::scanCell(GridGraph* maze){ // scans current cell for wa
     number_of_unexplored--;
     
     // gathering x edges within maze at robot's current position
-    LocalMap->x_edges[y_position][x_position] = maze->x_edges[y_position][x_position]; // east
-    LocalMap->x_edges[y_position][x_position+1] = maze->x_edges[y_position][x_position+1]; // west
+    LocalMap->setXEdge(x_position, y_position, maze->getXEdge(x_position, y_position)); // east
+    LocalMap->setXEdge(x_position+1, y_position, maze->getXEdge(x_position+1, y_position)); // west
     
     // gathering y edges within maze at robot's current position
-    LocalMap->y_edges[y_position][x_position] = maze->y_edges[y_position][x_position]; // north
-    LocalMap->y_edges[y_position+1][x_position] = maze->y_edges[y_position+1][x_position]; // south
+    LocalMap->setYEdge(x_position, y_position, maze->getYEdge(x_position, y_position)); // north
+    LocalMap->setYEdge(x_position, y_position+1, maze->getYEdge(x_position, y_position+1)); // south
 
     // placing edges within return vector for usage by RobotMaster -> [0] = north, [1] = south, [2] = east, [3] = west
-    ret_vector.push_back(maze->y_edges[y_position][x_position]); // north
-    ret_vector.push_back(maze->y_edges[y_position+1][x_position]); // south
-    ret_vector.push_back(maze->x_edges[y_position][x_position]); // east
-    ret_vector.push_back(maze->x_edges[y_position][x_position+1]); // west
+    ret_vector.push_back(maze->getYEdge(x_position, y_position)); // north
+    ret_vector.push_back(maze->getYEdge(x_position, y_position+1)); // south
+    ret_vector.push_back(maze->getXEdge(x_position, y_position)); // east
+    ret_vector.push_back(maze->getXEdge(x_position+1, y_position)); // west
     
 
     // updating state of current node 
-    LocalMap->nodes[y_position][x_position] = 1; // setting currently scanned node to 1 to signifiy its been scanned 
+    LocalMap->setNode(x_position, y_position, 1); // setting currently scanned node to 1 to signifiy its been scanned 
+    localMapCellChanged(x_position, y_position);
 
     // updating state of neighbouring nodes to unexplored if possible
     
     // checking north
-    if(!LocalMap->y_edges[y_position][x_position] && LocalMap->nodes[y_position - 1][x_position] == 0){ // checking if node to north hasn't been explored
-        LocalMap->nodes[y_position - 1][x_position] = 2; // if unexplored and no wall between robot and cell, set northern node to unexplored
+    if(!LocalMap->getYEdge(x_position, y_position) && LocalMap->getNode(x_position, y_position - 1) == 0){ // checking if node to north hasn't been explored
+        LocalMap->setNode(x_position, y_position - 1, 2); // if unexplored and no wall between robot and cell, set northern node to unexplored
+        localMapCellChanged(x_position, y_position - 1);
         number_of_unexplored++;
     }
     // checking south
-    if(!LocalMap->y_edges[y_position + 1][x_position] && LocalMap->nodes[y_position + 1][x_position] == 0){ // checking if node to north hasn't been explored
-        LocalMap->nodes[y_position + 1][x_position] = 2; // if unexplored and no wall between robot and cell, set southern node to unexplored
+    if(!LocalMap->getYEdge(x_position, y_position + 1) && LocalMap->getNode(x_position, y_position + 1) == 0){ // checking if node to north hasn't been explored
+        LocalMap->setNode(x_position, y_position + 1, 2); // if unexplored and no wall between robot and cell, set southern node to unexplored
+        localMapCellChanged(x_position, y_position + 1);
         number_of_unexplored++;
     }
     // checking east
-    if(!LocalMap->x_edges[y_position][x_position] && LocalMap->nodes[y_position][x_position - 1] == 0){ // checking if node to north hasn't been explored
-        LocalMap->nodes[y_position][x_position - 1] = 2; // if unexplored and no wall between robot and cell, set eastern node to unexplored
+    if(!LocalMap->getXEdge(x_position, y_position) && LocalMap->getNode(x_position - 1, y_position) == 0){ // checking if node to north hasn't been explored
+        LocalMap->setNode(x_position - 1, y_position, 2); // if unexplored and no wall between robot and cell, set eastern node to unexplored
+        localMapCellChanged(x_position - 1, y_position);
         number_of_unexplored++;
     }
     // checking wast
-    if(!LocalMap->x_edges[y_position][x_position + 1] && LocalMap->nodes[y_position][x_position + 1] == 0){ // checking if node to north hasn't been explored
-        LocalMap->nodes[y_position][x_position + 1] = 2; // if unexplored and no wall between robot and cell, set western node to unexplored
+    if(!LocalMap->getXEdge(x_position + 1, y_position) && LocalMap->getNode(x_position + 1, y_position) == 0){ // checking if node to north hasn't been explored
+        LocalMap->setNode(x_position + 1, y_position, 2); // if unexplored and no wall between robot and cell, set western node to unexplored
+        localMapCellChanged(x_position + 1, y_position);
         number_of_unexplored++;
     }
     return ret_vector;
@@ -80,7 +94,7 @@ bool Robot::move2Cell(int direction){ // function to move robot depending on loc
     switch (direction){ // switch statement to move robot in specific direction based on know information from local map
         case 1:
         {
-            if (!LocalMap->y_edges[y_position][x_position]){ // if there is an edge between current node and node above
+            if (!LocalMap->getYEdge(x_position, y_position)){ // if there is an edge between current node and node above
                 y_position--; // move robot to node above
                 ret_value = true; // ret_value = true as movement was a success
             }
@@ -88,7 +102,7 @@ bool Robot::move2Cell(int direction){ // function to move robot depending on loc
         }
         case 2:
         {
-            if (!LocalMap->y_edges[y_position+1][x_position]){ // if there is an edge between current node and node below
+            if (!LocalMap->getYEdge(x_position, y_position+1)){ // if there is an edge between current node and node below
                 y_position++; // move robot to node below
                 ret_value = true; // ret_value = true as movement was a success
             }
@@ -96,7 +110,7 @@ bool Robot::move2Cell(int direction){ // function to move robot depending on loc
         }
         case 3:
         {
-            if (!LocalMap->x_edges[y_position][x_position]){ // if there is an edge between current node and node to the left
+            if (!LocalMap->getXEdge(x_position, y_position)){ // if there is an edge between current node and node to the left
                 x_position--; // move robot to node to the left
                 ret_value = true; // ret_value = true as movement was a success
             }
@@ -104,7 +118,7 @@ bool Robot::move2Cell(int direction){ // function to move robot depending on loc
         }
         case 4:
         {
-            if (!LocalMap->x_edges[y_position][x_position+1]){ // if there is an edge between current node and node to the right 
+            if (!LocalMap->getXEdge(x_position+1, y_position)){ // if there is an edge between current node and node to the right 
                 x_position++; // move robot to node to the right
                 ret_value = true; // ret_value = true as movement was a success
             }
@@ -158,39 +172,39 @@ std::vector<Coordinates> Robot::getValidNeighbours(int x, int y){ // function to
     std::vector<Coordinates> neighbours; // vector of Coordinates to return
                                          // this will contain the coordinates of valid neighbouring nodes
 
-    if(LocalMap->nodes[y][x] == 2 || LocalMap->nodes[y][x] == 3){ // if the current node is unexplored or leads to a dead end, don't get nearest neighbours
+    if(LocalMap->getNode(x, y) == 2 || LocalMap->getNode(x, y) == 3){ // if the current node is unexplored or leads to a dead end, don't get nearest neighbours
         return neighbours;
     }
 
     Coordinates buffer; // buffer structor to gather positions of neighbouring nodes before pushing to vector
 
     // check if neighbour to the north is valid and connected via an edge (no wall)
-    if(!LocalMap->y_edges[y][x]){
-        if (LocalMap->nodes[y-1][x] == 1 || LocalMap->nodes[y-1][x] == 2){
+    if(!LocalMap->getYEdge(x, y)){
+        if (LocalMap->getNode(x, y-1) == 1 || LocalMap->getNode(x, y-1) == 2){
             buffer.x = x; 
             buffer.y = y - 1;
             neighbours.push_back(buffer);
         }
     }
     // check if neighbour to the south is valid and connected via an edge (no wall)
-    if(!LocalMap->y_edges[y+1][x]){
-        if (LocalMap->nodes[y+1][x] == 1 || LocalMap->nodes[y+1][x] == 2){
+    if(!LocalMap->getYEdge(x, y+1)){
+        if (LocalMap->getNode(x, y+1) == 1 || LocalMap->getNode(x, y+1) == 2){
             buffer.x = x; 
             buffer.y = y + 1;
             neighbours.push_back(buffer);
         }
     }
     // check if neighbour to the east is valid and connected via an edge (no wall)
-    if(!LocalMap->x_edges[y][x]){
-        if (LocalMap->nodes[y][x-1] == 1 || LocalMap->nodes[y][x-1] == 2){
+    if(!LocalMap->getXEdge(x, y)){
+        if (LocalMap->getNode(x-1, y) == 1 || LocalMap->getNode(x-1, y) == 2){
             buffer.x = x - 1; 
             buffer.y = y;
             neighbours.push_back(buffer);
         }
     }
     // check if neighbour to the west is valid and connected via an edge (no wall)
-    if(!LocalMap->x_edges[y][x+1]){
-        if (LocalMap->nodes[y][x+1] == 1 || LocalMap->nodes[y][x+1] == 2){
+    if(!LocalMap->getXEdge(x+1, y)){
+        if (LocalMap->getNode(x+1, y) == 1 || LocalMap->getNode(x+1, y) == 2){
             buffer.x = x + 1; 
             buffer.y = y;
             neighbours.push_back(buffer);
@@ -198,58 +212,19 @@ std::vector<Coordinates> Robot::getValidNeighbours(int x, int y){ // function to
     }
 
 
-    std::random_shuffle(neighbours.begin(), neighbours.end()); // randomizing neighbours to remove bias when selecting a neighbor at intersections
+    std::shuffle(neighbours.begin(), neighbours.end(), tie_breaker); // randomizing neighbours to remove bias when selecting a neighbor at intersections
 
     return neighbours; // returning vector
 }
 
-bool Robot::pf_BFS(int x_dest, int y_dest){ // function to plan a path for robot to follow from current position to a specified destination
+bool Robot::pf_2Target(int x_dest, int y_dest){ // function to plan a path for robot to follow from current position to a specified destination
     
-    planned_path.clear(); // clearing planned_path as new path is to be planned using breadth first search
-
-    bool path_found = false; // variable to track whether a path has been found
-
-    std::queue<Coordinates> node_queue; // creating node queue to store nodes to be "explored" by algorithm
+    planned_path.clear(); // clearing planned_path as new path is to be planned
 
-    std::map<Coordinates, Coordinates> visited_nodes; // map to track explored nodes to their parent node
+    Coordinates start(x_position, y_position);
+    Coordinates destination(x_dest, y_dest);
 
-    // initializing first node to explore from with robot's current coordinates
-    Coordinates curr_node(x_position, y_position); 
-
-    node_queue.push(curr_node); // adding first node to explore to node queue
-    visited_nodes.insert({curr_node, curr_node}); // adding first node to visited node maps using itself as parent
-
-    while(node_queue.size() != 0){// while nodes to explore are in node_queue
-        
-        curr_node = node_queue.front(); // gathering node from front of queue
-
-        //printf("curr node: %d,%d\n", curr_node.x, curr_node.y);
-
-        node_queue.pop(); // removing node from front of the queue
-
-        if (curr_node.x == x_dest && curr_node.y == y_dest){ // if the target node has been located
-            path_found = true; // return true as path found
-            break; // break from while loop
-        }
-        
-        std::vector<Coordinates> valid_neighbours = getValidNeighbours(curr_node.x, curr_node.y); // gathering neighbours of current node
-
-        for(int i = 0; i < valid_neighbours.size(); i ++){ // iterate through all of the current node's neighbours to see if they have been explored
-            
-            bool node_in_map = false; // variable to track whether neighbour is in map
-            
-            for(auto [key, val]: visited_nodes){ // iterate through visited_nodes
-                if (key == valid_neighbours[i]){ // if current neighbour is in map
-                    node_in_map = true;          // set node_in_map
-                    break;
-                }
-            }
-            if(!node_in_map){ // if neighbour not found in map
-                node_queue.push(valid_neighbours[i]); // add to node_queue and visited nodes
-                visited_nodes.insert({valid_neighbours[i], curr_node}); 
-            }
-        }
-    }
+    bool path_found = Planner->planPath(&Workspace, start, destination, [this](int x, int y){ return getValidNeighbours(x, y); }); // searching LocalMap for path to destination
     
     if(!path_found){ // if no path found, return false
         return path_found;
@@ -258,26 +233,17 @@ bool Robot::pf_BFS(int x_dest, int y_dest){ // function to plan a path for robot
     // as a valid path has been found from current position to target using robot's local map
     // must travel from destination back through parent nodes to reconstruct path
     
-    curr_node.x = x_dest; // ensuring the current node is pointing to destination
-    curr_node.y = y_dest; // this allows for the "walk back" through nodes to start to occur
-    
-    while(!(curr_node.x == x_position && curr_node.y == y_position)){ // while the starting node has not been found from parents
-
-        planned_path.push_front(curr_node); // add current node to top of planned path "stack"
+    int start_index = Workspace.toIndex(start);
 
-        for(auto [key, val]: visited_nodes){ // TODO: use better search for key function
-            if (key == curr_node){
-                curr_node = val;
-                break;
-            }
-        }
+    for(int curr_index = Workspace.toIndex(destination); curr_index != start_index; curr_index = Workspace.getParent(curr_index)){ // while the starting node has not been found from parents
+        planned_path.push_front(Workspace.toCoordinates(curr_index)); // add current node to top of planned path "stack"
     }
 
     return path_found; 
 }
 
 bool Robot::BFS_exitCondition(Coordinates* node_to_test){
-    return (LocalMap->nodes[node_to_test->y][node_to_test->x] == 2);
+    return (LocalMap->getNode(node_to_test->x, node_to_test->y) == 2);
 }
 
 bool Robot::BFS_pf2NearestUnknownCell(std::deque<Coordinates>* ret_stack){
@@ -286,21 +252,31 @@ bool Robot::BFS_pf2NearestUnknownCell(std::deque<Coordinates>* ret_stack){
 
     bool ret_value = false; // return value
 
-    std::queue<Coordinates> node_queue; // creating node queue to store nodes to be "explored" by algorithm
+    Coordinates curr_node(x_position, y_position); 
+    int start_index = FrontierSearch.toIndex(curr_node);
+    int curr_index = start_index;
 
-    std::map<Coordinates, Coordinates> visited_nodes; // map to track explored nodes to their parent node
+    // previous search can be resumed if robot has not moved and no map changes have invalidated it
+    // every node popped from the queue during the previous search still fails the exit condition so search can continue from the front of the queue
+    // the front of the queue is the previously returned cell which is tested again in case it is still valid
+    bool resume_search = (frontier_search_mode == fs_IncrementalBFS && frontier_search_valid && frontier_search_source == curr_node);
 
-    // initializing first node to explore from with robot's current coordinates
-    Coordinates curr_node(x_position, y_position); 
+    if(!resume_search){ // starting search from robot's current coordinates
+        FrontierSearch.beginSearch(); // invalidating visited nodes and queue of any previous search
 
-    node_queue.push(curr_node); // adding first node to explore to node queue
-    visited_nodes.insert({curr_node, curr_node}); // adding first node to visited node maps using itself as parent
+        FrontierSearch.push(start_index); // adding first node to explore to node queue
+        FrontierSearch.visit(start_index, start_index); // marking first node as visited using itself as parent
 
-    while(node_queue.size() != 0){// while nodes to explore are in node_queue
+        frontier_search_source = curr_node;
+    }
+
+    frontier_search_valid = (frontier_search_mode == fs_IncrementalBFS); // search state is only kept if incremental search is being used
+
+    while(!FrontierSearch.queueEmpty()){// while nodes to explore are in node_queue
         
-        curr_node = node_queue.front(); // gathering node from front of queue
+        curr_index = FrontierSearch.front(); // gathering node from front of queue
+        curr_node = FrontierSearch.toCoordinates(curr_index);
 
-        //printf("curr node: %d,%d\n", curr_node.x, curr_node.y);
         std::vector<Coordinates>  valid_neighbours; // creating cector to store valid neigbours in following else if statement
 
         if (BFS_exitCondition(&curr_node)){ // if exit conditon has been met
@@ -309,42 +285,36 @@ bool Robot::BFS_pf2NearestUnknownCell(std::deque<Coordinates>* ret_stack){
         }
         // gathering nearest neighbours and checking if the node is a dead end (e.g. one neighbour and has already been visited). 
         // if it is a dead end, mark nodes along dead end path with 3. this prevents these paths from being searched during pathfinding
-        else if(valid_neighbours = getValidNeighbours(curr_node.x, curr_node.y); valid_neighbours.size() == 1 && LocalMap->nodes[curr_node.y][curr_node.x] == 1 && curr_node.x != x_position && curr_node.y != y_position){
+        else if(valid_neighbours = getValidNeighbours(curr_node.x, curr_node.y); valid_neighbours.size() == 1 && LocalMap->getNode(curr_node.x, curr_node.y) == 1 && curr_node.x != x_position && curr_node.y != y_position){
                     Coordinates node_to_test = curr_node; // gathering dead end node before testing
+                    int test_index = curr_index;
                     std::vector<Coordinates> neighbours; // vector to store neighbours during branch removal
                     do{
-                        LocalMap->nodes[node_to_test.y][node_to_test.x] = 3; // marking node leading to dead end as 3
+                        LocalMap->setNode(node_to_test.x, node_to_test.y, 3); // marking node leading to dead end as 3
 
-                        for(auto [key, val]: visited_nodes){ // searching to find parent node (node before this node)
-                            if (key == node_to_test){ // if parent node found
-                                node_to_test = val; // test it on next iteration
-                                break;
-                            }
-                        }
+                        test_index = FrontierSearch.getParent(test_index); // finding parent node (node before this node) to test on next iteration
+                        node_to_test = FrontierSearch.toCoordinates(test_index);
 
                         neighbours = getValidNeighbours(node_to_test.x, node_to_test.y); // check next node's neighbours to see if it still leads to dead end
                     }while(neighbours.size() == 1 && node_to_test.x != x_position && node_to_test.y != y_position); // checking if node leads to a dead end (1 valid neighbour)
                 }
 
-        node_queue.pop(); // removing node from front of the queue as new nodes must be added to queue
+        FrontierSearch.pop(); // removing node from front of the queue as new nodes must be added to queue
 
         for(int i = 0; i < valid_neighbours.size(); i ++){ // iterate through all of the current node's neighbours to see if they have been explored
-            bool node_in_map = false; // variable to track whether neighbour is in map
             
-            for(auto [key, val]: visited_nodes){ // iterate through visited_nodes
-                if (key == valid_neighbours[i]){ // if current neighbour is in map
-                    node_in_map = true;          // set node_in_map
-                    break;    
-                }
-            }
-            if(!node_in_map){ // if neighbour not found in map
-                node_queue.push(valid_neighbours[i]); // add to node_queue and visited nodes
-                visited_nodes.insert({valid_neighbours[i], curr_node});
+            int neighbour_index = FrontierSearch.toIndex(valid_neighbours[i]);
+
+            if(!FrontierSearch.isVisited(neighbour_index)){ // if neighbour has not been visited
+                FrontierSearch.push(neighbour_index); // add to node_queue and visited nodes
+                FrontierSearch.visit(neighbour_index, curr_index);
             }
         }
     }
 
     if (ret_value == false){ // if ret_value == fsle, 
+        frontier_search_valid = false; // exhausted search cannot be resumed
+
         BFS_noPathFound(); // function which handles if a path is not found
                            // does nothing in robot class as meant to be handled by child classes
 
@@ -354,20 +324,48 @@ bool Robot::BFS_pf2NearestUnknownCell(std::deque<Coordinates>* ret_stack){
     // as a valid path has been found from current position to target using robot's local map
     // must travel from destination back through parent nodes to reconstruct path
 
-    while(!(curr_node.x == x_position && curr_node.y == y_position)){ // while the starting node has not been found from parents
+    for(; curr_index != start_index; curr_index = FrontierSearch.getParent(curr_index)){ // while the starting node has not been found from parents
+        ret_stack->push_front(FrontierSearch.toCoordinates(curr_index)); // add current node to top of planned path "stack"
+    }
 
-        ret_stack->push_front(curr_node); // add current node to top of planned path "stack"
+    return ret_value; 
+}
 
-        for(auto [key, val]: visited_nodes){ // iterating through visited nodes map
-            if (key == curr_node){ // if parent node to current node it found
-                curr_node = val; // set parent node as current node
-                break;
-            }
+void Robot::resetFrontierSearch(){
+    frontier_search_valid = false;
+
+    return;
+}
+
+void Robot::localMapCellChanged(int x, int y){ // must be called after every change to LocalMap made outside of a search
+
+    // saved search is only unaffected if the changed cell and its neighbours were never reached by it
+    // a cell beyond the searched area will be read with its new state once the search reaches it
+    if(!frontier_search_valid){ // nothing to invalidate
+        return;
+    }
+
+    int dx[5] = {0, 0, 0, -1, 1}; // changed cell followed by its north, south, east and west neighbours
+    int dy[5] = {0, -1, 1, 0, 0};
+
+    for(int i = 0; i < 5; i++){
+        int nx = x + dx[i];
+        int ny = y + dy[i];
+
+        if(nx < 0 || ny < 0 || nx >= LocalMap->getXSize() || ny >= LocalMap->getYSize()){ // ignoring cells outside of map
+            continue;
+        }
+
+        if(FrontierSearch.isVisited(FrontierSearch.toIndex(nx, ny))){ // if cell has been reached by search, its distances may no longer be valid
+            frontier_search_valid = false;
+            return;
         }
     }
-    return ret_value; 
+
+    return;
 }
 
+
 bool Robot::printRobotMaze(){ // function to print robot's local map of maze
                               // maze design based off what can be seen here: https://www.chegg.com/homework-help/questions-and-answers/using-c-1-write-maze-solving-program-following-functionality-note-implementation-details-a-q31826669
 
@@ -391,7 +389,7 @@ bool Robot::printRobotMaze(){ // function to print robot's local map of maze
 
             for(int j = 0; j < maze_xsize; j++){
 
-                if(LocalMap->y_edges[i][j]){ // if there is no edge between two nodes
+                if(LocalMap->getYEdge(j, i)){ // if there is no edge between two nodes
                     string_pointer = 1; // print horizontal line
                 }
                 else{ // if there is an edge between two nodes
@@ -407,7 +405,7 @@ bool Robot::printRobotMaze(){ // function to print robot's local map of maze
             for(int j = 0; j < maze_xsize + 1; j++){
 
                 // checking the walls between two nodes (e.g. wall?, no wall?)
-                if(LocalMap->x_edges[i][j]){ // if there is no edge between two nodes
+                if(LocalMap->getXEdge(j, i)){ // if there is no edge between two nodes
                     string_pointer = 2; // print horizontal line
                 }
                 else{ // if there is an edge between two nodes
@@ -422,10 +420,10 @@ bool Robot::printRobotMaze(){ // function to print robot's local map of maze
                 else if(j == x_position && i == y_position){ // if current node is the robot's location
                     string_pointer = 4; // print R for robot
                 }
-                else if(LocalMap->nodes[i][j] == 0){ // if current node is invalid (unseen and unexplored)
+                else if(LocalMap->getNode(j, i) == 0){ // if current node is invalid (unseen and unexplored)
                     string_pointer = 6; // print I for invalid cell
                 }
-                else if(LocalMap->nodes[i][j] == 2){ // if current node has been seen but not explored
+                else if(LocalMap->getNode(j, i) == 2){ // if current node has been seen but not explored
                     string_pointer = 7; // print * for seen node
                 }
                 else{ // if current cell has been seen and explored (valid)
@@ -466,9 +464,11 @@ void Robot::setLocalMap(GridGraph* new_map){ // sets LocalMap
                                              // do not call this function if robot has already explored
     *LocalMap = *new_map; // setting gridgraph value
 
-    for(int i = 0; i < LocalMap->nodes.size(); i++){ // need to account for all unexplored cells in new map
-        for(int j = 0; j < LocalMap->nodes[i].size(); j++){
-            if(LocalMap->nodes[i][j] == 2)
+    resetFrontierSearch(); // entire map has changed
+
+    for(int i = 0; i < LocalMap->getYSize(); i++){ // need to account for all unexplored cells in new map
+        for(int j = 0; j < LocalMap->getXSize(); j++){
+            if(LocalMap->getNode(j, i) == 2)
                 number_of_unexplored++;
         }
     }
@@ -476,6 +476,23 @@ void Robot::setLocalMap(GridGraph* new_map){ // sets LocalMap
     return;
 }
 
+void Robot::setFrontierSearchMode(int mode){
+    frontier_search_mode = mode;
+
+    resetFrontierSearch(); // ensuring a search from another mode is never resumed
+
+    return;
+}
+
+void Robot::setPathPlanner(int planner_type){
+    PathPlanner* new_planner = createPathPlanner(planner_type); // allocating before deleting so Planner remains valid if type is invalid
+
+    delete Planner;
+    Planner = new_planner;
+
+    return;
+}
+
 void Robot::BFS_noPathFound(){ // function which handles if a path is not found
     return;
 }
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include "RobotScheduler.h"
+
+// ** RobotBehaviour Functions **
+
+RobotBehaviour::~RobotBehaviour(){
+    if(handle){ // behaviour was never spawned
+        handle.destroy();
+    }
+}
+
+std::coroutine_handle<> RobotBehaviour::release(){
+
+    std::coroutine_handle<> released = handle;
+    handle = {};
+
+    return released;
+}
+
+// ** RobotScheduler Constructors **
+
+RobotScheduler::RobotScheduler(){
+    num_of_running_behaviours = 0;
+    current_turn = 0;
+    current_behaviour = -1;
+}
+
+RobotScheduler::~RobotScheduler(){
+
+    for(int i = 0; i < behaviours.size(); i++){ // destroying suspended behaviours, e.g. robots still waiting for RobotMaster once maze was mapped
+        if(behaviours[i]){
+            behaviours[i].destroy();
+        }
+    }
+}
+
+// ** Behaviour Functions **
+
+int RobotScheduler::spawn(RobotBehaviour behaviour){
+
+    int index = behaviours.size();
+
+    behaviours.push_back(behaviour.release());
+    num_of_running_behaviours++;
+
+    resume(index); // running behaviour until it first waits
+
+    return index;
+}
+
+void RobotScheduler::runTurn(unsigned int turn){
+
+    current_turn = turn;
+
+    while(!wake_up_events.empty() && wake_up_events.top().first <= turn){ // resuming every behaviour due on or before this turn
+        int i = wake_up_events.top().second;
+        wake_up_events.pop();
+
+        resume(i);
+    }
+
+    return;
+}
+
+void RobotScheduler::wakeMessageWaiters(){
+
+    for(int k = 0; k < message_waiters.size(); k++){
+        if(message_waiters[k].second->hasMessagesFromMaster()){
+            wake_up_events.push({current_turn + 1, message_waiters[k].first}); // message is handled by robot on next turn
+
+            message_waiters[k] = message_waiters.back(); // removing behaviour from waiters
+            message_waiters.pop_back();
+            k--;
+        }
+    }
+
+    return;
+}
+
+void RobotScheduler::resume(int behaviour){
+
+    current_behaviour = behaviour;
+
+    behaviours[behaviour].resume(); // runs until behaviour awaits or finishes
+
+    current_behaviour = -1;
+
+    if(behaviours[behaviour].done()){ // behaviour has returned
+        behaviours[behaviour].destroy();
+        behaviours[behaviour] = {};
+        num_of_running_behaviours--;
+    }
+
+    return;
+}
+
+void RobotScheduler::scheduleCurrent(unsigned int turn){
+
+    if(current_behaviour < 0){
+        throw "Critical Error: Robot behaviour awaited outside of RobotScheduler";
+    }
+
+    wake_up_events.push({turn, current_behaviour});
+
+    return;
+}
+
+void RobotScheduler::waitCurrentForMaster(MultiRobot* robot){
+
+    if(current_behaviour < 0){
+        throw "Critical Error: Robot behaviour awaited outside of RobotScheduler";
+    }
+
+    if(robot->hasMessagesFromMaster()){ // message already sent, robot handles it on next turn
+        wake_up_events.push({current_turn + 1, current_behaviour});
+    }
+    else{
+        message_waiters.push_back({current_behaviour, robot});
+    }
+
+    return;
+}
@@ -0,0 +1,150 @@
+#include "TraceWriter.h"
+
+// ** TraceWriter Constructors **
+
+TraceWriter::TraceWriter(std::string trace_directory): trace_directory(trace_directory), requests_stream(trace_directory + TRACE_REQUESTS_FILE, std::ios::binary), paths_stream(trace_directory + TRACE_PATHS_FILE, std::ios::binary){
+
+    trace_open = requests_stream.is_open() && paths_stream.is_open();
+    closing = false;
+    number_of_turns = 0;
+    number_of_traces = 0;
+
+    pthread_mutex_init(&queue_lock, NULL);
+    pthread_cond_init(&turn_added, NULL);
+    pthread_cond_init(&turn_written, NULL);
+
+    if(trace_open){
+        TraceHeader header = { {'M', 'R', 'T', 'R'}, TRACE_VERSION, sizeof(TraceRecord), 0 }; // number of turns is filled in once trace is closed
+        requests_stream.write((char*)&header, sizeof(TraceHeader));
+
+        pthread_create(&writer_thread, NULL, &writerFunc, (void*)this);
+    }
+}
+
+TraceWriter::~TraceWriter(){
+
+    close();
+
+    for(int i = 0; i < free_traces.size(); i++){ // every turn buffer is free once trace is closed
+        delete free_traces[i];
+    }
+
+    pthread_mutex_destroy(&queue_lock);
+    pthread_cond_destroy(&turn_added);
+    pthread_cond_destroy(&turn_written);
+}
+
+// ** Trace Functions **
+
+void TraceWriter::writeTurn(unsigned int turn, RequestTrace* turn_trace){
+
+    if(!trace_open){ // turns are dropped if there is no file to write them to
+        turn_trace->clear();
+        return;
+    }
+
+    pthread_mutex_lock(&queue_lock);
+
+    while(free_traces.empty() && number_of_traces >= TRACE_QUEUE_CAPACITY){ // waiting for writer to catch up
+        pthread_cond_wait(&turn_written, &queue_lock);
+    }
+
+    RequestTrace* queued_trace;
+
+    if(free_traces.empty()){
+        queued_trace = new RequestTrace();
+        number_of_traces++;
+    }
+    else{
+        queued_trace = free_traces.back();
+        free_traces.pop_back();
+    }
+
+    pthread_mutex_unlock(&queue_lock);
+
+    queued_trace->swap(turn_trace); // turn_trace is left with the empty buffers of a written turn
+    queued_trace->setTurn(turn);
+
+    pthread_mutex_lock(&queue_lock);
+    turn_queue.push_back(queued_trace);
+    pthread_cond_signal(&turn_added);
+    pthread_mutex_unlock(&queue_lock);
+
+    return;
+}
+
+void TraceWriter::writeInfo(json info){
+
+    this->info = std::move(info);
+
+    return;
+}
+
+void TraceWriter::close(){
+
+    if(!trace_open){
+        return;
+    }
+
+    pthread_mutex_lock(&queue_lock);
+    closing = true; // writer exits once queue is empty
+    pthread_cond_signal(&turn_added);
+    pthread_mutex_unlock(&queue_lock);
+
+    pthread_join(writer_thread, NULL); // waiting for every turn to be written
+
+    requests_stream.seekp(offsetof(TraceHeader, number_of_turns)); // filling in number of turns now that it is known
+    requests_stream.write((char*)&number_of_turns, sizeof(uint32_t));
+
+    requests_stream.close();
+    paths_stream.close();
+
+    if(!info.is_null()){
+        std::ofstream info_stream(trace_directory + TRACE_INFO_FILE);
+        info_stream << info.dump(4) << std::endl;
+    }
+
+    trace_open = false;
+
+    return;
+}
+
+void* TraceWriter::writerFunc(void* Writer_Info){ // loop run by background thread writing queued turns
+
+    TraceWriter* Writer = (TraceWriter*) Writer_Info;
+
+    while(true){
+        pthread_mutex_lock(&Writer->queue_lock);
+
+        while(Writer->turn_queue.empty() && !Writer->closing){ // waiting for a turn
+            pthread_cond_wait(&Writer->turn_added, &Writer->queue_lock);
+        }
+
+        if(Writer->turn_queue.empty()){ // trace is closing and every turn has been written
+            pthread_mutex_unlock(&Writer->queue_lock);
+            break;
+        }
+
+        RequestTrace* turn_trace = Writer->turn_queue.front();
+        Writer->turn_queue.pop_front();
+
+        pthread_mutex_unlock(&Writer->queue_lock);
+
+        // records are written outside of lock so simulation can keep adding turns
+        const std::vector<TraceRecord>& records = turn_trace->getRecords();
+        const std::vector<int32_t>& paths = turn_trace->getPaths();
+
+        Writer->requests_stream.write((const char*)records.data(), records.size() * sizeof(TraceRecord));
+        Writer->paths_stream.write((const char*)paths.data(), paths.size() * sizeof(int32_t));
+        Writer->number_of_turns++;
+
+        turn_trace->clear();
+
+        pthread_mutex_lock(&Writer->queue_lock);
+        Writer->free_traces.push_back(turn_trace);
+        pthread_cond_signal(&Writer->turn_written);
+        pthread_mutex_unlock(&Writer->queue_lock);
+    }
+
+    pthread_exit(NULL); // return from thread
+}
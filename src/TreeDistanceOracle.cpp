@@ -0,0 +1,225 @@
+#include "TreeDistanceOracle.h"
+
+TreeDistanceOracle::TreeDistanceOracle(int x, int y){ // allocating oracle for a map of size x by y
+    x_size = x;
+    y_size = y;
+
+    is_tree = true; // an empty map is a forest
+
+    parent.assign(x*y, 0);
+    jump.assign(x*y, 0);
+    depth.assign(x*y, 0);
+    component.assign(x*y, -1); // all cells unknown
+    component_size.assign(x*y, 0);
+    links.assign(x*y, 0);
+}
+
+// ** Maintenance Functions **
+
+void TreeDistanceOracle::addCell(Coordinates C){ // adds a known cell with no connections
+    int i = toIndex(C);
+
+    if(component[i] >= 0){ // already known
+        return;
+    }
+
+    component[i] = i; // cell is the root of a new tree
+    component_size[i] = 1;
+    setRoot(i);
+
+    return;
+}
+
+void TreeDistanceOracle::addConnection(Coordinates a, Coordinates b){ // adds an open connection between two neighbouring cells
+
+    if(!is_tree){ // structure is no longer maintained once a cycle has been found
+        return;
+    }
+
+    addCell(a);
+    addCell(b);
+
+    int ia = toIndex(a);
+    int ib = toIndex(b);
+    int dir = linkDirection(ia, ib);
+
+    if(dir < 0){
+        throw "Critical Error: TreeDistanceOracle connection between cells which are not neighbours";
+    }
+
+    if(links[ia] & (1 << dir)){ // connection already added (e.g. seen from both sides)
+        return;
+    }
+
+    links[ia] |= (1 << dir);
+    links[ib] |= (1 << (dir ^ 1));
+
+    if(component[ia] == component[ib]){ // both cells were already connected so this closes a cycle
+        is_tree = false;
+        return;
+    }
+
+    // joining trees by re-rooting the smaller tree below the connecting cell of the larger tree
+    int small_cell = ia;
+    int big_cell = ib;
+    if(component_size[component[ia]] > component_size[component[ib]]){
+        small_cell = ib;
+        big_cell = ia;
+    }
+
+    int small_id = component[small_cell];
+    int big_id = component[big_cell];
+
+    std::queue<int> cell_queue; // cells are re-attached in breadth first order so parents are always attached before children
+
+    component[small_cell] = big_id;
+    setParent(small_cell, big_cell);
+    cell_queue.push(small_cell);
+
+    while(!cell_queue.empty()){
+        int curr = cell_queue.front();
+        cell_queue.pop();
+
+        for(int d = 0; d < 4; d++){
+            if(!(links[curr] & (1 << d))){
+                continue;
+            }
+
+            int n = neighbourIndex(curr, d);
+
+            if(component[n] == small_id){ // cell in smaller tree which has not been re-attached
+                component[n] = big_id;
+                setParent(n, curr);
+                cell_queue.push(n);
+            }
+        }
+    }
+
+    component_size[big_id] += component_size[small_id];
+    component_size[small_id] = 0;
+
+    return;
+}
+
+// ** Query Functions **
+
+int TreeDistanceOracle::getDistance(Coordinates a, Coordinates b){ // length of path between cells
+    int ia = toIndex(a);
+    int ib = toIndex(b);
+
+    if(!is_tree || component[ia] < 0 || component[ia] != component[ib]){ // no answer available
+        return -1;
+    }
+
+    return depth[ia] + depth[ib] - 2*depth[getLCA(ia, ib)];
+}
+
+bool TreeDistanceOracle::getPath(Coordinates a, Coordinates b, std::deque<Coordinates>* path){ // path contains every cell after a up to and including b
+
+    path->clear();
+
+    int ia = toIndex(a);
+    int ib = toIndex(b);
+
+    if(!is_tree || component[ia] < 0 || component[ia] != component[ib]){ // no answer available
+        return false;
+    }
+
+    int lca = getLCA(ia, ib);
+
+    for(int i = ia; i != lca; ){ // climbing from a up to and including lowest common ancestor
+        i = parent[i];
+        path->push_back(toCoordinates(i));
+    }
+
+    std::vector<int> descent; // cells from b up to lowest common ancestor, these are added in reverse
+    for(int i = ib; i != lca; i = parent[i]){
+        descent.push_back(i);
+    }
+
+    for(int k = descent.size() - 1; k >= 0; k--){
+        path->push_back(toCoordinates(descent[k]));
+    }
+
+    return true;
+}
+
+// ** Helper Functions **
+
+int TreeDistanceOracle::linkDirection(int a, int b){ // direction of b from a
+    if(b == a - x_size) return 0; // north
+    if(b == a + x_size) return 1; // south
+    if(b == a - 1 && a % x_size != 0) return 2; // east
+    if(b == a + 1 && b % x_size != 0) return 3; // west
+    return -1;
+}
+
+int TreeDistanceOracle::neighbourIndex(int i, int dir){
+    switch(dir){
+        case 0: return i - x_size; // north
+        case 1: return i + x_size; // south
+        case 2: return i - 1; // east
+        default: return i + 1; // west
+    }
+}
+
+void TreeDistanceOracle::setRoot(int i){
+    parent[i] = i;
+    jump[i] = i;
+    depth[i] = 0;
+
+    return;
+}
+
+void TreeDistanceOracle::setParent(int i, int p){ // attaches cell below parent and computes its jump pointer
+                                                  // jump pointers form a skew-binary structure, any ancestor can be reached in O(log n) jumps
+    parent[i] = p;
+    depth[i] = depth[p] + 1;
+
+    int j = jump[p];
+
+    if(depth[p] - depth[j] == depth[j] - depth[jump[j]]){ // two equal sized jumps above parent can be combined
+        jump[i] = jump[j];
+    }
+    else{
+        jump[i] = p;
+    }
+
+    return;
+}
+
+int TreeDistanceOracle::ancestorAtDepth(int i, int d){ // ancestor of cell at depth d
+    while(depth[i] > d){
+        if(depth[jump[i]] >= d){ // taking jump if it does not overshoot
+            i = jump[i];
+        }
+        else{
+            i = parent[i];
+        }
+    }
+
+    return i;
+}
+
+int TreeDistanceOracle::getLCA(int a, int b){ // lowest common ancestor of two cells in the same tree
+
+    if(depth[a] > depth[b]){ // bringing both cells to same depth
+        a = ancestorAtDepth(a, depth[b]);
+    }
+    else{
+        b = ancestorAtDepth(b, depth[a]);
+    }
+
+    while(a != b){ // cells at the same depth have jump pointers to the same depth
+        if(jump[a] != jump[b]){
+            a = jump[a];
+            b = jump[b];
+        }
+        else{
+            a = parent[a];
+            b = parent[b];
+        }
+    }
+
+    return a;
+}
@@ -0,0 +1,185 @@
+#include "TurnExecutor.h"
+
+TurnExecutor::TurnExecutor(int num_of_threads){
+
+    if(num_of_threads <= 0){ // using one thread per hardware thread
+        num_of_threads = std::thread::hardware_concurrency();
+
+        if(num_of_threads <= 0){ // number of hardware threads could not be determined
+            num_of_threads = 1;
+        }
+    }
+
+    num_of_workers = num_of_threads;
+
+    task_ranges = std::vector<TaskRange>(num_of_workers);
+    for(int i = 0; i < num_of_workers; i++){
+        task_ranges[i].range.store(0, std::memory_order_relaxed); // workers own no tasks until a phase starts
+    }
+
+    phase_task = NULL;
+    shutting_down = false;
+
+    phase_exception = NULL;
+    pthread_mutex_init(&phase_exception_lock, NULL);
+
+    // initializing barriers to number of workers (all workers + calling thread must be waiting before a phase can start/finish)
+    pthread_barrier_init(&phase_start_barrier, NULL, num_of_workers);
+    pthread_barrier_init(&phase_end_barrier, NULL, num_of_workers);
+
+    worker_threads.resize(num_of_workers - 1);
+    worker_args.resize(num_of_workers - 1);
+
+    for(int i = 1; i < num_of_workers; i++){ // calling thread is worker 0
+        worker_args[i - 1].executor = this;
+        worker_args[i - 1].worker = i;
+
+        pthread_create(&worker_threads[i - 1], NULL, &workerFunc, (void*)&worker_args[i - 1]);
+    }
+}
+
+TurnExecutor::~TurnExecutor(){
+
+    shutting_down = true; // workers exit once released from phase_start_barrier
+    pthread_barrier_wait(&phase_start_barrier);
+
+    for(int i = 0; i < worker_threads.size(); i++){ // waiting for worker threads to finish
+        pthread_join(worker_threads[i], NULL);
+    }
+
+    pthread_barrier_destroy(&phase_start_barrier);
+    pthread_barrier_destroy(&phase_end_barrier);
+    pthread_mutex_destroy(&phase_exception_lock);
+}
+
+// ** Phase Functions **
+
+void TurnExecutor::runPhase(int num_of_tasks, const std::function<void(int)>& task){ // runs task(i) for every i in [0, num_of_tasks)
+
+    if(num_of_tasks <= 0){
+        return;
+    }
+
+    // splitting tasks evenly between workers before they are released
+    for(int i = 0; i < num_of_workers; i++){
+        unsigned long first = (unsigned long)num_of_tasks*i / num_of_workers;
+        unsigned long last = (unsigned long)num_of_tasks*(i + 1) / num_of_workers;
+
+        task_ranges[i].range.store(packRange(first, last), std::memory_order_relaxed); // barrier makes ranges visible to workers
+    }
+
+    phase_task = &task;
+
+    pthread_barrier_wait(&phase_start_barrier); // fork: releasing workers into phase
+
+    runTasks(0);
+
+    pthread_barrier_wait(&phase_end_barrier); // join: waiting for every task of phase to complete
+
+    phase_task = NULL;
+
+    if(phase_exception != NULL){ // a task failed, passing its exception on to calling thread
+        std::exception_ptr exception = phase_exception;
+        phase_exception = NULL; // executor can still run later phases
+
+        std::rethrow_exception(exception);
+    }
+
+    return;
+}
+
+// ** Worker Functions **
+
+void* TurnExecutor::workerFunc(void* Worker_Info){ // loop run by every worker thread other than calling thread
+    // gathering passed data
+    WorkerArgs* Data = (WorkerArgs*) Worker_Info;
+    TurnExecutor* Executor = Data->executor;
+
+    while(true){
+        pthread_barrier_wait(&Executor->phase_start_barrier); // waiting for next phase
+
+        if(Executor->shutting_down){ // executor is being destroyed
+            break;
+        }
+
+        Executor->runTasks(Data->worker);
+
+        pthread_barrier_wait(&Executor->phase_end_barrier); // signalling worker has no tasks left
+    }
+
+    pthread_exit(NULL); // return from thread
+}
+
+void TurnExecutor::runTasks(int worker){ // runs tasks owned by worker, then steals tasks until none remain
+
+    int task;
+
+    do{
+        while(takeTask(worker, &task)){
+            try{
+                (*phase_task)(task);
+            }
+            catch(...){ // an exception must not escape a worker thread, it is rethrown by runPhase
+                pthread_mutex_lock(&phase_exception_lock);
+
+                if(phase_exception == NULL){ // only first exception of phase is kept
+                    phase_exception = std::current_exception();
+                }
+
+                pthread_mutex_unlock(&phase_exception_lock);
+            }
+        }
+    } while(stealTasks(worker)); // once stealing fails every task has been taken by a worker
+
+    return;
+}
+
+bool TurnExecutor::takeTask(int worker, int* task){ // takes first task owned by worker, false if worker owns none
+
+    std::atomic<unsigned long>* range = &task_ranges[worker].range;
+    unsigned long curr_range = range->load(std::memory_order_acquire);
+
+    while(true){
+        unsigned long first = curr_range >> 32;
+        unsigned long last = curr_range & 0xFFFFFFFF;
+
+        if(first >= last){ // worker owns no tasks
+            return false;
+        }
+
+        if(range->compare_exchange_weak(curr_range, packRange(first + 1, last), std::memory_order_acq_rel, std::memory_order_acquire)){
+            *task = first;
+            return true;
+        }
+        // a thief changed range, retrying with updated range
+    }
+}
+
+bool TurnExecutor::stealTasks(int thief){ // moves half of the tasks of another worker to thief, false if no worker has any tasks left
+
+    for(int i = 1; i < num_of_workers; i++){ // visiting workers in order after thief so thieves spread out over victims
+        int victim = (thief + i) % num_of_workers;
+
+        std::atomic<unsigned long>* range = &task_ranges[victim].range;
+        unsigned long curr_range = range->load(std::memory_order_acquire);
+
+        while(true){
+            unsigned long first = curr_range >> 32;
+            unsigned long last = curr_range & 0xFFFFFFFF;
+
+            if(first >= last){ // victim has no tasks left
+                break;
+            }
+
+            unsigned long middle = first + (last - first)/2; // victim keeps [first, middle), thief takes [middle, last)
+
+            if(range->compare_exchange_weak(curr_range, packRange(first, middle), std::memory_order_acq_rel, std::memory_order_acquire)){
+                task_ranges[thief].range.store(packRange(middle, last), std::memory_order_release); // thief's range is empty so no other worker can change it
+                return true;
+            }
+            // victim or another thief changed range, retrying with updated range
+        }
+    }
+
+    return false;
+}
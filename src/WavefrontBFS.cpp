@@ -0,0 +1,311 @@
+#include "WavefrontBFS.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+WavefrontBFS::WavefrontBFS(){ // creating empty wavefront
+    x_size = 0;
+    y_size = 0;
+    row_words = 0;
+
+    Map = NULL;
+
+    dirty_first = 0;
+    dirty_last = -1;
+    layer_distance = 0;
+}
+
+WavefrontBFS::WavefrontBFS(int x, int y){ // allocating wavefront for a map of size x by y
+    x_size = x;
+    y_size = y;
+    row_words = (x + 1 + 63)/64; // must match row width used by GridGraph
+
+    Map = NULL;
+
+    expandable.assign(row_words*y, 0); // allocating all planes
+    enterable.assign(row_words*y, 0);
+    visited.assign(row_words*y, 0);
+    layer.assign(row_words*y, 0);
+    next_layer.assign(row_words*y, 0);
+    source_mask.assign(row_words*y, 0);
+
+    distance.assign(x*y, 0);
+
+    row_active.assign(y, 0);
+
+    dirty_first = 0; // nothing has been reached
+    dirty_last = -1;
+    layer_distance = 0;
+}
+
+void WavefrontBFS::beginSearch(const GridGraph* map, int map_type){ // loads cell masks from map and clears previous search
+
+    if(map->getXSize() != x_size || map->getYSize() != y_size){
+        throw "Critical Error: WavefrontBFS size does not match map";
+    }
+
+    Map = map;
+
+    for(int y = 0; y < y_size; y++){ // converting 2 bit node states into masks
+        const uint64_t* low = Map->getNodeLowRow(y);
+        const uint64_t* high = Map->getNodeHighRow(y);
+
+        for(int w = 0; w < row_words; w++){
+            int i = y*row_words + w;
+
+            if(map_type == wf_FrontierMap){
+                expandable[i] = low[w] ^ high[w]; // unexplored cells can only be in a layer if they were added as a source
+                enterable[i] = low[w] & ~high[w];
+            }
+            else{
+                expandable[i] = (low[w] | high[w]);
+                enterable[i] = (low[w] | high[w]);
+            }
+        }
+    }
+
+    if(dirty_first <= dirty_last){ // only rows reached by previous search can have visited cells
+        std::fill(visited.begin() + dirty_first*row_words, visited.begin() + (dirty_last + 1)*row_words, 0);
+    }
+
+    for(int k = 0; k < active_rows.size(); k++){
+        row_active[active_rows[k]] = 0;
+    }
+    active_rows.clear(); // layer is empty until a source is added
+
+    dirty_first = y_size;
+    dirty_last = -1;
+    layer_distance = 0;
+
+    return;
+}
+
+void WavefrontBFS::activateRow(int y){ // adds row y to rows of current layer, clearing cells left in it by earlier layers
+
+    if(row_active[y]){
+        return;
+    }
+
+    std::fill(layer.begin() + y*row_words, layer.begin() + (y + 1)*row_words, 0);
+    row_active[y] = 1;
+
+    active_rows.insert(std::upper_bound(active_rows.begin(), active_rows.end(), y), y); // keeping rows in ascending order
+
+    return;
+}
+
+void WavefrontBFS::addSource(Coordinates source){ // adds a cell to layer 0 of the search
+
+    activateRow(source.y);
+
+    int i = source.y*row_words + (source.x >> 6);
+    uint64_t bit = 1ULL << (source.x & 63);
+
+    layer[i] |= bit;
+    visited[i] |= bit;
+    distance[source.y*x_size + source.x] = 0;
+
+    dirty_first = std::min(dirty_first, source.y); // visited must be cleared in this row by next search
+    dirty_last = std::max(dirty_last, source.y);
+
+    return;
+}
+
+bool WavefrontBFS::expandLayer(){ // computes the next layer of the search
+
+    if(layerEmpty()){ // nothing left to expand
+        return false;
+    }
+
+    // cells can only be expanded from if they are expandable
+    for(int k = 0; k < active_rows.size(); k++){
+        for(int w = active_rows[k]*row_words; w < (active_rows[k] + 1)*row_words; w++){
+            source_mask[w] = layer[w] & expandable[w];
+        }
+    }
+
+    layer_distance++;
+
+    next_rows.clear();
+    int last_expanded = -1; // rows are expanded in ascending order, each only once
+
+    for(int k = 0; k < active_rows.size(); k++){
+        int first_row = std::max(std::max(0, active_rows[k] - 1), last_expanded + 1); // next layer can only reach one row above and below a row of the current layer
+        int last_row = std::min(y_size - 1, active_rows[k] + 1);
+
+        for(int y = first_row; y <= last_row; y++){
+            expandRow(y);
+            last_expanded = y;
+
+            bool row_reached = false;
+
+            for(int w = 0; w < row_words; w++){ // recording newly reached cells
+                int i = y*row_words + w;
+                uint64_t reached = next_layer[i];
+
+                if(reached == 0){
+                    continue;
+                }
+
+                visited[i] |= reached;
+                row_reached = true;
+
+                while(reached){ // storing distance of every reached cell
+                    int x = w*64 + __builtin_ctzll(reached);
+                    distance[y*x_size + x] = layer_distance;
+                    reached &= reached - 1; // clearing lowest set bit
+                }
+            }
+
+            if(row_reached){
+                next_rows.push_back(y);
+                dirty_first = std::min(dirty_first, y);
+                dirty_last = std::max(dirty_last, y);
+            }
+        }
+    }
+
+    for(int k = 0; k < active_rows.size(); k++){
+        row_active[active_rows[k]] = 0;
+    }
+    for(int k = 0; k < next_rows.size(); k++){
+        row_active[next_rows[k]] = 1;
+    }
+
+    std::swap(layer, next_layer); // next layer becomes current layer
+    std::swap(active_rows, next_rows);
+
+    return !layerEmpty();
+}
+
+void WavefrontBFS::expandRow(int y){ // computes row y of next layer from current layer
+                                     // a cell moving from x to x+1 is blocked by x edge x+1, moving from x to x-1 is blocked by x edge x
+                                     // a cell moving from row y-1 to y or y to y-1 is blocked by y edge y of column x
+
+    const uint64_t* x_walls = Map->getXEdgeRow(y);
+    const uint64_t* north_walls = Map->getYEdgeRow(y); // walls between row y-1 and y
+    const uint64_t* south_walls = Map->getYEdgeRow(y + 1); // walls between row y and y+1
+
+    // gathering rows of current layer which can reach row y, rows which are not active are empty
+    const uint64_t* same_row = row_active[y] ? &source_mask[y*row_words] : NULL;
+    const uint64_t* north_row = (y > 0 && row_active[y - 1]) ? &source_mask[(y - 1)*row_words] : NULL;
+    const uint64_t* south_row = (y + 1 < y_size && row_active[y + 1]) ? &source_mask[(y + 1)*row_words] : NULL;
+
+    const uint64_t* allowed = &enterable[y*row_words];
+    const uint64_t* reached = &visited[y*row_words];
+    uint64_t* out = &next_layer[y*row_words];
+
+    int w = 0;
+
+#ifdef __AVX2__
+    __m256i zero = _mm256_setzero_si256();
+
+    for(; w + 4 <= row_words; w += 4){ // processing 256 cells per iteration
+        __m256i v = zero;
+
+        if(same_row != NULL){
+            __m256i s = _mm256_loadu_si256((const __m256i*)(same_row + w));
+            __m256i xw = _mm256_loadu_si256((const __m256i*)(x_walls + w));
+
+            // words offset by one are loaded directly to carry bits between words
+            __m256i s_prev = (w > 0) ? _mm256_loadu_si256((const __m256i*)(same_row + w - 1)) : _mm256_set_epi64x(same_row[2], same_row[1], same_row[0], 0);
+            __m256i s_next;
+            __m256i xw_next;
+            if(w + 5 <= row_words){
+                s_next = _mm256_loadu_si256((const __m256i*)(same_row + w + 1));
+                xw_next = _mm256_loadu_si256((const __m256i*)(x_walls + w + 1));
+            }
+            else{
+                s_next = _mm256_set_epi64x(0, same_row[w + 3], same_row[w + 2], same_row[w + 1]);
+                xw_next = _mm256_set_epi64x(0, x_walls[w + 3], x_walls[w + 2], x_walls[w + 1]);
+            }
+
+            __m256i plus_x = _mm256_or_si256(_mm256_slli_epi64(s, 1), _mm256_srli_epi64(s_prev, 63)); // x to x+1
+            plus_x = _mm256_andnot_si256(xw, plus_x);
+
+            __m256i t = _mm256_andnot_si256(xw, s); // x to x-1
+            __m256i t_next = _mm256_andnot_si256(xw_next, s_next);
+            __m256i minus_x = _mm256_or_si256(_mm256_srli_epi64(t, 1), _mm256_slli_epi64(t_next, 63));
+
+            v = _mm256_or_si256(plus_x, minus_x);
+        }
+        if(north_row != NULL){ // row y-1 to y
+            __m256i n = _mm256_loadu_si256((const __m256i*)(north_row + w));
+            v = _mm256_or_si256(v, _mm256_andnot_si256(_mm256_loadu_si256((const __m256i*)(north_walls + w)), n));
+        }
+        if(south_row != NULL){ // row y+1 to y
+            __m256i s = _mm256_loadu_si256((const __m256i*)(south_row + w));
+            v = _mm256_or_si256(v, _mm256_andnot_si256(_mm256_loadu_si256((const __m256i*)(south_walls + w)), s));
+        }
+
+        v = _mm256_and_si256(v, _mm256_loadu_si256((const __m256i*)(allowed + w)));
+        v = _mm256_andnot_si256(_mm256_loadu_si256((const __m256i*)(reached + w)), v);
+
+        _mm256_storeu_si256((__m256i*)(out + w), v);
+    }
+#endif
+
+    for(; w < row_words; w++){ // scalar kernel, also handles words remaining after AVX2 loop
+        uint64_t v = 0;
+
+        if(same_row != NULL){
+            uint64_t s_prev = (w > 0) ? same_row[w - 1] : 0;
+            uint64_t t_next = (w + 1 < row_words) ? (same_row[w + 1] & ~x_walls[w + 1]) : 0;
+
+            uint64_t plus_x = ((same_row[w] << 1) | (s_prev >> 63)) & ~x_walls[w]; // x to x+1
+            uint64_t minus_x = ((same_row[w] & ~x_walls[w]) >> 1) | (t_next << 63); // x to x-1
+
+            v = plus_x | minus_x;
+        }
+        if(north_row != NULL){ // row y-1 to y
+            v |= north_row[w] & ~north_walls[w];
+        }
+        if(south_row != NULL){ // row y+1 to y
+            v |= south_row[w] & ~south_walls[w];
+        }
+
+        out[w] = v & allowed[w] & ~reached[w];
+    }
+
+    return;
+}
+
+bool WavefrontBFS::isReached(Coordinates C){ // whether cell has been reached by search
+    return (visited[C.y*row_words + (C.x >> 6)] >> (C.x & 63)) & 1;
+}
+
+int WavefrontBFS::getDistance(Coordinates C){ // distance of reached cell from its nearest source
+    if(!isReached(C)){
+        return -1;
+    }
+
+    return distance[C.y*x_size + C.x];
+}
+
+void WavefrontBFS::computeDistanceField(const GridGraph* map, int map_type, std::vector<Coordinates>* sources, std::vector<int>* distances){ // runs search until exhausted and stores distance of every cell
+
+    beginSearch(map, map_type);
+
+    for(int i = 0; i < sources->size(); i++){
+        addSource((*sources)[i]);
+    }
+
+    while(expandLayer()); // expanding until no new cells are reached
+
+    distances->assign(x_size*y_size, -1);
+
+    for(int y = dirty_first; y <= dirty_last; y++){ // gathering distances of reached cells, no other rows were reached
+        for(int w = 0; w < row_words; w++){
+            uint64_t bits = visited[y*row_words + w];
+
+            while(bits){
+                int x = w*64 + __builtin_ctzll(bits);
+                (*distances)[y*x_size + x] = distance[y*x_size + x];
+                bits &= bits - 1; // clearing lowest set bit
+            }
+        }
+    }
+
+    return;
+}
@@ -4,6 +4,9 @@
 #include <filesystem>
 #include <utility>
 #include <random>
+#include <queue>
+#include <chrono>
+#include <limits>
 
 #include "Maze.h"
 #include "RobotMaster_NC.h"
@@ -11,66 +14,111 @@
 #include "RobotMaster_NC_FCFS.h"
 #include "RobotMaster_C_Greedy.h"
 #include "RobotMaster_C_FCFS.h"
+#include "RobotMaster_C_Batch.h"
+#include "RobotMaster_NC_Batch.h"
 #include "MultiRobot_NC.h"
 #include "MultiRobot_NC_CellReservation.h"
 #include "MultiRobot_C_CellReservation.h"
+#include "TurnExecutor.h"
+#include "RobotScheduler.h"
+#include "TraceWriter.h"
+#include "FrameRecorder.h"
+#include "FrameRenderer.h"
+#include "Telemetry.h"
 
 using namespace std;
 
 using json = nlohmann::json; // simplifying namespace so "json" can be used instead of "nlohmann::json" when declaring json objects
 
-struct TurnControlData{ // struct containing data used by robot and master threads to control turn flow
-    
-    pthread_barrier_t turn_start_barrier, turn_end_barrier; // barriers to synchronize robot threads into a turn format
+// simulation engines
+#define se_TurnExecutor 0 // every robot executes every turn in parallel on a pool of worker threads
+#define se_DiscreteEvent 1 // single thread which only executes robots on turns where they act, turns where nothing happens are skipped
+                           // deterministic for a given maze and start positions, best suited to running many simulations at once
+#define se_Coroutine 2 // single thread which runs every robot as a coroutine awaiting turn delays and RobotMaster messages
+                       // gives identical results to se_DiscreteEvent while each robot only costs its coroutine frame, best suited to very large swarms
+
+struct SearchSettings{ // search algorithms used by robots and RobotMaster, menus always use the defaults while experiment files can select them
+
+    int frontier_search; // fs_ mode robots use to find their nearest unknown cell, batch robots always use fs_MasterField
+                         // fs_MasterField is only valid for cell reservation robots (types 1 to 4)
+    int path_planner; // pp_ planner robots and RobotMaster use to find a path to a known cell
+    bool distance_oracle; // whether RobotMaster answers distance queries with a tree distance oracle, exact in perfect mazes
+                          // once GlobalMap has a cycle (maze files need not be perfect) RobotMaster falls back to its planner
+
+    SearchSettings(){
+        frontier_search = fs_IncrementalBFS;
+        path_planner = pp_AStar;
+        distance_oracle = true; // generated mazes are always perfect
+    }
+};
+
+struct RobotTurnState{ // structure to track turn flow of a single robot
+
+    MultiRobot* Generated_Robot; // dynamically allocated robot
+
+    int robot_execution_status; // tracks what state the robot executed in last robot loop pass
     
-    pthread_mutex_t finished_counter_mutex; // mutexes to protect the counters
+    int number_of_turns_to_wait; // tracks the number of turns robot has to sit out before executing a robotloop step
+
+    RobotTurnState(MultiRobot* R1){
+        Generated_Robot = R1;
+        robot_execution_status = s_stand_by;
+        number_of_turns_to_wait = 0; // initialzing to zero as robot should not wait on its first turn
+    }
+};
+
+#define TURNS_PER_CELL_WITHOUT_MAP_CHANGE 16 // a simulation whose GlobalMap has not changed for this many turns per cell of the maze is stuck in a cycle
+                                             // far longer than any robot needs to cross every cell of the maze to its next frontier cell
 
-    bool all_robots_completed; // tracks number of robots which have completed a turn
+struct MapProgress{ // structure to track when a simulation last changed GlobalMap
 
-    TurnControlData(int num_robots){
-        // initialzing barrier to number of robots + 1 (all robots + robot master must be waiting before next turn can start/finish)
-        pthread_barrier_init(&turn_start_barrier, NULL, num_robots + 1);
-        pthread_barrier_init(&turn_end_barrier, NULL, num_robots + 1);
+    unsigned int last_map_changes; // number of changes RobotMaster had made to GlobalMap when last checked
 
-        // intialzing pthread mutexes
-        pthread_mutex_init(&finished_counter_mutex, NULL);
+    unsigned int last_change_turn; // turn on which GlobalMap was last seen to change
 
-        all_robots_completed = false; // initializing finished_robots to 0 as no robots have finished executing fully
+    unsigned int turn_limit; // most turns GlobalMap may go without changing
+
+    MapProgress(GridGraph* Maze_Map){
+        last_map_changes = 0;
+        last_change_turn = 0;
+        turn_limit = TURNS_PER_CELL_WITHOUT_MAP_CHANGE*Maze_Map->getXSize()*Maze_Map->getYSize();
     }
-    ~TurnControlData(){
-        // detroying pthread barrier and mutexes
-        pthread_barrier_destroy(&turn_start_barrier);
-        pthread_mutex_destroy(&finished_counter_mutex);
+
+    void checkProgress(RobotMaster* RM, unsigned int turn_counter){ // must be called once RobotMaster has handled requests of a turn, throws once robots are stuck in a cycle
+        if(RM->getNumberofMapChanges() != last_map_changes){
+            last_map_changes = RM->getNumberofMapChanges();
+            last_change_turn = turn_counter;
+        }
+        else if(turn_counter - last_change_turn > turn_limit){
+            throw "Critical Error: GlobalMap has stopped changing before maze has been mapped, robots are stuck in a cycle";
+        }
     }
 };
 
-struct RobotMasterArgs{ // structure to hold args for passing RobotMaster information into a new thread
+struct SimulationArgs{ // structure to hold args for passing simulation information into a simulation engine
     RobotMaster* Generated_RobotMaster; // dynamically allocated robotmaster
 
-    TurnControlData* turn_control; // struct containing info to control robot's turn
+    vector<RobotTurnState> robots; // every robot in the simulation
 
-    json turn_json; // json containing request infomation of robot's action during each turn
+    GridGraph* Maze_Map; // Map of maze used by robots to scan cells
+                         // shared by all robots as it is only ever read during a simulation
+
+    TraceWriter* Trace; // trace each turn's request information is streamed to as soon as the turn is recorded, NULL if requests are not traced
     
-    vector<string> maze_printouts; // vector containing maze printouts for export to text files
+    FrameRecorder* Frames; // recorder GlobalMap and robot positions are saved to each turn, NULL if printouts are not exported
 
-    RobotMasterArgs(RobotMaster* R1, TurnControlData* control_info){
-        Generated_RobotMaster = R1;
-        turn_control = control_info;
-    }
-};
+    vector<Coordinates> robot_positions; // positions of robots on turn being recorded, reused every turn
 
-struct RobotArgs{ // structure to hold args for passing robot information into a new thread
-    MultiRobot* Generated_Robot; // dynamically allocated robot
-    GridGraph Maze_Map; // Map of maze used by robot to scan cells
+    json summary; // information on whole simulation, set once simulation has finished
 
-    TurnControlData* turn_control; // struct containing info to control robot's turn
+    int worker_threads; // most worker threads a simulation engine may run robots on
 
-    RobotArgs(MultiRobot* R1, GridGraph M, TurnControlData* control_info){
-        Generated_Robot = R1;
-        Maze_Map.nodes = M.nodes;
-        Maze_Map.x_edges = M.x_edges;
-        Maze_Map.y_edges = M.y_edges;
-        turn_control = control_info;
+    SimulationArgs(RobotMaster* R1, GridGraph* M, TraceWriter* T, FrameRecorder* F, int W){
+        Generated_RobotMaster = R1;
+        Maze_Map = M;
+        Trace = T;
+        Frames = F;
+        worker_threads = W;
     }
 };
 
@@ -92,122 +140,322 @@ int getTurns2Wait(int last_status_of_execution){ // returns the number of turns
     }
 }
 
-void* robotFunc(void* Robot_Info){ // function for robot running threads
-    // gathering passed data
-    RobotArgs* Data = (RobotArgs*) Robot_Info; // argument structure containing passed data
-    MultiRobot* R = Data->Generated_Robot; // robot to run in this thread
-    TurnControlData* TurnControl = Data->turn_control; // turn control mechanisms
+void executeRobotTurn(RobotTurnState* Robot_State, GridGraph* Maze_Map){ // executes a single turn of a robot
 
-    R->robotSetUp(); // setting up robot before loop intialization
+    if(Robot_State->robot_execution_status == s_exit_loop){ // robot has been shut down, it sits out every remaining turn
+        return;
+    }
 
-    int robot_execution_status = s_stand_by; // tracks what state the robot executed in last robot loop pass
-    
-    int number_of_turns_to_wait = 0; // tracks the number of turns robot has to sit out before executing a robotloop step
-                                     // initialzing to zero as robot should not wait on its first turn
-    
-    while(robot_execution_status != s_exit_loop){ // continue executing turns until the robot has been put into shut down state
+    MultiRobot* R = Robot_State->Generated_Robot;
+
+    if(Robot_State->number_of_turns_to_wait == 0){ // if robot does not have to sit out for a turn, execute robot loop step
+
+        Robot_State->robot_execution_status = R->robotLoopStepforSimulation(Maze_Map); // executing one step of the robot loop
+
+        Robot_State->number_of_turns_to_wait = getTurns2Wait(Robot_State->robot_execution_status); // determing how many turns robot has to sit out for before next operation 
+                                                                                                   // these turns help give the illusion of time taken for each type of request
+    }
+    else if(Robot_State->number_of_turns_to_wait == 1){ // if there is only 1 turn left to wait, compute the function which has been waiting  
+        R->computeRobotStatus(Maze_Map); // execute robot state
+    }
 
-        pthread_barrier_wait(&TurnControl->turn_start_barrier); // waiting for all threads to complete preivous turn initialization before starting next turn
+    Robot_State->number_of_turns_to_wait--; // subtract number of turns to wait as robot has finished a turn
 
-        if(number_of_turns_to_wait == 0){ // if robot does not have to sit out for a turn, execute robot loop step
+    return;
+}
+
+RobotBehaviour multiRobotBehaviour(RobotScheduler* Scheduler, MultiRobot* R, GridGraph* Maze_Map){ // runs the state machine of an existing robot as a coroutine
+                                                                                                   // takes the same turns as executeRobotTurn, delays are awaited instead of counted down
+    R->robotSetUp(); // setting up robot before its first turn
+
+    co_await Scheduler->waitTurns(1);
 
-            robot_execution_status = R->robotLoopStepforSimulation(&Data->Maze_Map); // executing one step of the robot loop
- 
-            number_of_turns_to_wait = getTurns2Wait(robot_execution_status); // determing how many turns robot has to sit out for before next operation 
-                                                                             // these turns help give the illusion of time taken for each type of request
+    while(true){
+        int status_of_execution = R->robotLoopStepforSimulation(Maze_Map); // executing one step of the robot loop
+
+        if(status_of_execution == s_exit_loop){ // robot has been shut down
+            co_return;
         }
-        else if(number_of_turns_to_wait == 1){ // if there is only 1 turn left to wait, compute the function which has been waiting  
-            R->computeRobotStatus(&Data->Maze_Map); // execute robot state
+
+        int turns_to_wait = getTurns2Wait(status_of_execution);
+
+        if(turns_to_wait >= 2){ // delayed status is computed on last turn of its delay
+            co_await Scheduler->waitTurns(turns_to_wait - 1);
+
+            R->computeRobotStatus(Maze_Map);
         }
 
-        pthread_barrier_wait(&TurnControl->turn_end_barrier); // waiting for all threads to complete preivous turn initialization before starting next turn
-        
-        number_of_turns_to_wait--; // subtract number of turns to wait as robot has finished a turn
+        if(R->getRobotStatus() == s_stand_by){ // robot does nothing until RobotMaster sends it a message
+            co_await Scheduler->waitForMaster(R);
+        }
+        else{
+            co_await Scheduler->waitTurns(1);
+        }
     }
+}
 
-    bool all_robots_done = false; // boolean to track whether all robots have completed their turns
+template<class Telemetry> void recordTurn(SimulationArgs* Data, unsigned int turn_counter, bool maze_mapped, bool map_changed){ // saves requests handled during a turn and a frame of GlobalMap, as far as Telemetry allows
+                                                                                                                                // map_changed can be false if no requests were handled since last recorded turn, GlobalMap is then not compared with previous frame
+    RobotMaster* RM = Data->Generated_RobotMaster;
 
-    pthread_mutex_lock(&TurnControl->finished_counter_mutex);
-    if(TurnControl->all_robots_completed){ // checking if all robots are completed (e.g. is this the last robot to finish)
-           all_robots_done = true; // no need to utilise barrier to facilitate more turns
+    if constexpr(Telemetry::requests){
+        Data->Trace->writeTurn(turn_counter, RM->getRequestTrace()); // requests handled during turn are written out by trace's writer thread, leaving RobotMaster's trace empty for next turn
+    }
+
+    if constexpr(Telemetry::turns){
+        if(!maze_mapped && Data->Frames != NULL){ // if statement to prevent maze from being recorded once all robots have completed exploration
+            RM->getRobotPositions(&Data->robot_positions);
+            Data->Frames->recordFrame(turn_counter, RM->getGlobalMap(), &Data->robot_positions, map_changed); // only changes since last turn are saved, printouts are rendered from frames once simulation is done
         }
-    pthread_mutex_unlock(&TurnControl->finished_counter_mutex);
+    }
+
+    return;
+}
 
-    while(!all_robots_done){ // loop to allow other robots to complete their turns by using the barriers
+template<class Telemetry> void recordSummary(SimulationArgs* Data, unsigned int turns_taken){ // saves information on whole simulation to Data->summary, as far as Telemetry allows
 
-        pthread_barrier_wait(&TurnControl->turn_start_barrier); // using various turn control barrier to allow other robots to complete their turns
-        pthread_barrier_wait(&TurnControl->turn_end_barrier);
+    if constexpr(Telemetry::summary){
+        RobotMaster* RM = Data->Generated_RobotMaster;
 
-        // checking if all robots are completed (e.g. does this thread need to keep using the barriers to ensure other threads finish)
-        pthread_mutex_lock(&TurnControl->finished_counter_mutex);
-        if(TurnControl->all_robots_completed){ // all robots have completed their turns 
-           all_robots_done = true; // exit loop as no need to use various barriers anymore
-        }
-        pthread_mutex_unlock(&TurnControl->finished_counter_mutex);
+        json summary_json;
+
+        summary_json["Info"]["Total_Turns_Taken"] = turns_taken; 
+        summary_json["Info"]["Number_of_Robots"] = RM->getNumberofRobots(); // getting number of robots
+        summary_json["Info"]["Number_of_Printouts"] = (Data->Frames != NULL) ? Data->Frames->getNumberofFrames() : 0; // adding number of printouts to simulation.json
 
+        GridGraph* ptr = RM->getGlobalMap(); // loading maze characteristics into json
+        summary_json["Maze_Characteristics"]["X_Size"] = ptr->getXSize();
+        summary_json["Maze_Characteristics"]["Y_Size"] = ptr->getYSize();
+
+        Data->summary = std::move(summary_json);
     }
 
-    pthread_exit(NULL); // return from thread
+    return;
 }
 
-void* masterFunc(void* RobotMaster_Info){ // function to run Robot Master in a seperate thread
+template<class Telemetry> void simulationFunc(SimulationArgs* Data){ // function to run a simulation turn by turn
+                                            // every turn all robots execute in parallel on a pool of worker threads, then RobotMaster handles requests sent during the turn
     // gathering passed data
-    RobotMasterArgs* Data = (RobotMasterArgs*) RobotMaster_Info; // argument structure containing passed data
     RobotMaster* RM = Data->Generated_RobotMaster; // robot master to run
-    TurnControlData* TurnControl = Data->turn_control; // turn control mechanisms
+    vector<RobotTurnState>* Robots = &Data->robots; // robots to run
+
+    int number_of_robots = Robots->size();
+
+    TurnExecutor Executor(std::min(Data->worker_threads, number_of_robots)); // no more worker threads than robots are needed
+
+    std::function<void(int)> robot_set_up = [Robots](int i){ (*Robots)[i].Generated_Robot->robotSetUp(); };
+    std::function<void(int)> robot_turn = [Robots, Data](int i){ executeRobotTurn(&(*Robots)[i], Data->Maze_Map); };
 
     unsigned int turn_counter = 0; // counter to track number of turns which have occured
 
     RM->robotMasterSetUp(); // setting up robot master before receiving requests
+    Executor.runPhase(number_of_robots, robot_set_up); // setting up robots before loop intialization
 
-    bool maze_mapped = false;
+    MapProgress Progress(Data->Maze_Map); // stops simulation if robots never finish mapping maze
 
-    pthread_barrier_wait(&TurnControl->turn_start_barrier); // start robot's first turn
+    bool maze_mapped = false;
 
     while(!maze_mapped){ // RobotMaster loop
         
-        pthread_barrier_wait(&TurnControl->turn_end_barrier); // waiting for robots to finish turn
+        Executor.runPhase(number_of_robots, robot_turn); // running a turn of every robot
 
         turn_counter++; // incrementing turn counter as a turn has finished
 
-        while(RM->getNumRequestsinQueue() != 0){ // while there are requests to receive on this turn, handle them
-            maze_mapped = RM->receiveRequests();
-        }
-        
-        json buffer_json; // load requests handled during turn into a json
-        
-        string name = "Turn_"; // creating turn number name
-        name += to_string(turn_counter);
+        maze_mapped = RM->receiveAllRequests(turn_counter); // handling every request sent on this turn as one batch
+
+        Progress.checkProgress(RM, turn_counter);
         
-        buffer_json[name] = RM->getRequestInfo(); // gathering json containing request info during this turn
-        Data->turn_json["Simulation"].push_back(buffer_json);
-        RM->clearRequestInfo(); // clearing contents of request info before next turn
+        recordTurn<Telemetry>(Data, turn_counter, maze_mapped, true); // saving requests handled during turn
+    }
 
-        if(!maze_mapped){ // if statement to prevent maze from being print once all robots have completed exploration
-            cout << "*Turn_" << turn_counter << "*\n"; // printing turn number
-            Data->maze_printouts.push_back("*Turn_" + to_string(turn_counter) + "*\n" + RM->printGlobalMap()); // printing global map and adding it to maze_prinouts
+    Executor.runPhase(number_of_robots, robot_turn); // final turn lets robots receive their shut down responses and exit their loop
+    
+    recordSummary<Telemetry>(Data, turn_counter); // saving various maze info
+
+    return;
+}
+
+template<class Telemetry> void eventSimulationFunc(SimulationArgs* Data){ // function to run a simulation as a sequence of robot wake-up events on the calling thread
+                                                 // robots are only executed on turns where they act, a robot in standby is only woken once RobotMaster sends it a message
+                                                 // turns where no robot is executed are skipped, their empty request info and printouts are still recorded
+                                                 // robots executing on the same turn always execute in order of their index so every run is identical
+    // gathering passed data
+    RobotMaster* RM = Data->Generated_RobotMaster; // robot master to run
+    vector<RobotTurnState>* Robots = &Data->robots; // robots to run
+
+    int number_of_robots = Robots->size();
+
+    priority_queue<pair<unsigned int, int>, vector<pair<unsigned int, int>>, greater<pair<unsigned int, int>>> wake_up_events; // (turn, robot index) pairs ordered by turn then robot index
+    vector<int> idle_robots; // robots in standby waiting for a message from RobotMaster
+
+    // lambda which schedules the next turn a robot must be executed on after it has executed on turn
+    auto scheduleRobot = [&](int i, unsigned int turn){
+        RobotTurnState* Robot_State = &(*Robots)[i];
+
+        if(Robot_State->robot_execution_status == s_exit_loop){ // robot has shut down and is never executed again
+            return;
+        }
+
+        if(Robot_State->number_of_turns_to_wait >= 2){ // turns before robot computes its delayed status only count down
+            wake_up_events.push({turn + Robot_State->number_of_turns_to_wait, i});
+            Robot_State->number_of_turns_to_wait = 1; // count down of skipped turns
+        }
+        else if(Robot_State->number_of_turns_to_wait == 0 && Robot_State->Generated_Robot->getRobotStatus() == s_stand_by && !Robot_State->Generated_Robot->hasMessagesFromMaster()){ // robot does nothing until a message is received
+            idle_robots.push_back(i);
+        }
+        else{
+            wake_up_events.push({turn + 1, i});
+        }
+    };
+
+    RM->robotMasterSetUp(); // setting up robot master before receiving requests
+
+    for(int i = 0; i < number_of_robots; i++){ // setting up robots before loop intialization
+        (*Robots)[i].Generated_Robot->robotSetUp();
+        wake_up_events.push({1, i}); // every robot executes on first turn
+    }
+
+    unsigned int turn_counter = 0; // counter to track number of turns which have occured
+
+    MapProgress Progress(Data->Maze_Map); // stops simulation if robots never finish mapping maze
+
+    bool maze_mapped = false;
+
+    while(!maze_mapped){ // RobotMaster loop
+
+        if(wake_up_events.empty()){ // no robot will ever act again
+            throw "Critical Error: Every robot is waiting for RobotMaster before maze has been mapped";
+        }
+
+        unsigned int next_turn = wake_up_events.top().first;
+
+        while(turn_counter + 1 < next_turn){ // nothing happens on turns before next event
+            turn_counter++;
+            recordTurn<Telemetry>(Data, turn_counter, false, false);
+        }
+
+        turn_counter = next_turn;
+
+        while(!wake_up_events.empty() && wake_up_events.top().first == turn_counter){ // executing every robot woken on this turn
+            int i = wake_up_events.top().second;
+            wake_up_events.pop();
+
+            executeRobotTurn(&(*Robots)[i], Data->Maze_Map);
+            scheduleRobot(i, turn_counter);
+        }
+
+        maze_mapped = RM->receiveAllRequests(turn_counter); // handling every request sent on this turn as one batch
+
+        Progress.checkProgress(RM, turn_counter);
+
+        for(int k = 0; k < idle_robots.size(); k++){ // waking robots in standby which have been sent a message
+            int i = idle_robots[k];
+
+            if((*Robots)[i].Generated_Robot->hasMessagesFromMaster()){
+                wake_up_events.push({turn_counter + 1, i});
+
+                idle_robots[k] = idle_robots.back(); // removing robot from idle robots
+                idle_robots.pop_back();
+                k--;
+            }
         }
 
-        pthread_barrier_wait(&TurnControl->turn_start_barrier); // signalling robots to begin next turn
+        recordTurn<Telemetry>(Data, turn_counter, maze_mapped, true); // saving requests handled during turn
     }
 
-    // safely telling other threads that all robots have completed their exploration
-    pthread_mutex_lock(&TurnControl->finished_counter_mutex);
-    TurnControl->all_robots_completed = true;
-    pthread_mutex_unlock(&TurnControl->finished_counter_mutex);
+    while(!wake_up_events.empty() && wake_up_events.top().first == turn_counter + 1){ // final turn lets robots receive their shut down responses and exit their loop
+        int i = wake_up_events.top().second;
+        wake_up_events.pop();
 
-    pthread_barrier_wait(&TurnControl->turn_end_barrier); // Signalling robot they can finally exit their loop after completion
+        executeRobotTurn(&(*Robots)[i], Data->Maze_Map);
+    }
     
-    // saving various maze info
-    Data->turn_json["Info"]["Total_Turns_Taken"] = turn_counter; 
-    Data->turn_json["Info"]["Number_of_Robots"] = RM->getNumberofRobots(); // getting number of robots
-    Data->turn_json["Info"]["Number_of_Printouts"] = Data->maze_printouts.size(); // adding number of printouts to simulation.json
+    recordSummary<Telemetry>(Data, turn_counter); // saving various maze info
+
+    return;
+}
+
+template<class Telemetry> void coroutineSimulationFunc(SimulationArgs* Data){ // function to run a simulation with every robot as a coroutine on the calling thread
+                                                     // turns where no robot is resumed are skipped, their empty request info and printouts are still recorded
+    // gathering passed data
+    RobotMaster* RM = Data->Generated_RobotMaster; // robot master to run
+    vector<RobotTurnState>* Robots = &Data->robots; // robots to run
+
+    RobotScheduler Scheduler;
+
+    RM->robotMasterSetUp(); // setting up robot master before receiving requests
+
+    for(int i = 0; i < Robots->size(); i++){ // robots are set up as they are spawned and wait for first turn
+        Scheduler.spawn(multiRobotBehaviour(&Scheduler, (*Robots)[i].Generated_Robot, Data->Maze_Map));
+    }
+
+    unsigned int turn_counter = 0; // counter to track number of turns which have occured
+
+    MapProgress Progress(Data->Maze_Map); // stops simulation if robots never finish mapping maze
+
+    bool maze_mapped = false;
+
+    while(!maze_mapped){ // RobotMaster loop
+
+        if(!Scheduler.hasScheduledTurns()){ // no robot will ever act again
+            throw "Critical Error: Every robot is waiting for RobotMaster before maze has been mapped";
+        }
+
+        unsigned int next_turn = Scheduler.getNextTurn();
 
-    GridGraph* ptr = RM->getGlobalMap(); // loading maze characteristics into json
-    Data->turn_json["Maze_Characteristics"]["X_Size"] = ptr->nodes[0].size();
-    Data->turn_json["Maze_Characteristics"]["Y_Size"] = ptr->nodes.size();
+        while(turn_counter + 1 < next_turn){ // nothing happens on turns before next robot is resumed
+            turn_counter++;
+            recordTurn<Telemetry>(Data, turn_counter, false, false);
+        }
+
+        turn_counter = next_turn;
+
+        Scheduler.runTurn(turn_counter); // resuming every robot due on this turn
+
+        maze_mapped = RM->receiveAllRequests(turn_counter); // handling every request sent on this turn as one batch
+
+        Progress.checkProgress(RM, turn_counter);
+
+        Scheduler.wakeMessageWaiters(); // robots sent a message are resumed next turn
+
+        recordTurn<Telemetry>(Data, turn_counter, maze_mapped, true); // saving requests handled during turn
+    }
+
+    Scheduler.runTurn(turn_counter + 1); // final turn lets robots receive their shut down responses and exit their loop
+
+    recordSummary<Telemetry>(Data, turn_counter); // saving various maze info
+
+    return;
+}
+
+typedef void (*SimulationFunction)(SimulationArgs*); // simulation loop of an engine, run on the thread which calls it
+
+template<class Telemetry> SimulationFunction getSimulationFunction(int simulation_engine){ // gets simulation loop of simulation_engine compiled with Telemetry
+                                                                                            // simulation_engine must already have been validated
+    switch(simulation_engine){
+        case se_TurnExecutor:
+            return &simulationFunc<Telemetry>;
+        case se_DiscreteEvent:
+            return &eventSimulationFunc<Telemetry>;
+        case se_Coroutine:
+            return &coroutineSimulationFunc<Telemetry>;
+    }
+
+    throw "Critical Error: Unknown simulation engine";
+}
 
-    pthread_exit(NULL); // return from thread
+SimulationFunction getSimulationFunction(int simulation_engine, int telemetry_level){ // gets simulation loop of simulation_engine which records only what telemetry_level requires
+
+    switch(telemetry_level){
+        case tl_Off:
+            return getSimulationFunction<Telemetry<tl_Off>>(simulation_engine);
+        case tl_Summary:
+            return getSimulationFunction<Telemetry<tl_Summary>>(simulation_engine);
+        case tl_Turn:
+            return getSimulationFunction<Telemetry<tl_Turn>>(simulation_engine);
+        default:
+            return getSimulationFunction<Telemetry<tl_Request>>(simulation_engine);
+    }
 }
 
 MultiRobot* getNewRobot(int robot_type, int x_pos, int y_pos, RequestHandler* request_handler, unsigned int xsize, unsigned int ysize){
@@ -227,7 +475,26 @@ MultiRobot* getNewRobot(int robot_type, int x_pos, int y_pos, RequestHandler* re
         {
             return new MultiRobot_NC(x_pos, y_pos, request_handler, xsize, ysize);
         }
+        case 6: // Selecting Collision, Batch
+                // batch types are left out of the menus as they do not yet reliably take fewer turns than Greedy
+        {
+            MultiRobot* new_robot = new MultiRobot_C_CellReservation(x_pos, y_pos, request_handler, xsize, ysize);
+            new_robot->setFrontierSearchMode(fs_MasterField); // batch assignment requires targets to be requested from RobotMaster
+            return new_robot;
+        }
+        case 7: // Selecting No Collision, Batch
+        {
+            MultiRobot* new_robot = new MultiRobot_NC_CellReservation(x_pos, y_pos, request_handler, xsize, ysize);
+            new_robot->setFrontierSearchMode(fs_MasterField); // batch assignment requires targets to be requested from RobotMaster
+            return new_robot;
+        }
+        default: // unknown robot type
+        {
+            return NULL;
+        }
     }
+
+    return NULL;
 }
 
 RobotMaster* getNewRobotMaster(int robot_type, int number_of_robots, RequestHandler* request_handler, unsigned int xsize, unsigned int ysize){
@@ -247,6 +514,18 @@ RobotMaster* getNewRobotMaster(int robot_type, int number_of_robots, RequestHand
     else if(robot_type == 5){ // if the robots to simulate are of type Collision, No Reservation
         return new RobotMaster_NC(request_handler, number_of_robots, xsize, ysize);
     }
+    else if(robot_type == 6){ // if the robots to simulate are of type Collision, Batch
+        return new RobotMaster_C_Batch(request_handler, number_of_robots, xsize, ysize);
+    }
+    else if(robot_type == 7){ // if the robots to simulate are of type No Collision, Batch
+        return new RobotMaster_NC_Batch(request_handler, number_of_robots, xsize, ysize);
+    }
+
+    return NULL; // unknown robot type
+}
+
+bool isRobotType(int robot_type){ // whether getNewRobot and getNewRobotMaster can create robot_type
+    return robot_type >= 1 && robot_type <= 7;
 }
 
 bool exportJSON(json json_2_export, string json_name, string target_directory){ // exports json to .json
@@ -269,82 +548,414 @@ bool exportJSON(json json_2_export, string json_name, string target_directory){
     return false;
 }
 
-void exportPrintOuts(vector<string>* strings_to_export, string target_directory){ // exports all printouts to a directory
+json runSimulation(Maze* Generated_Maze, int number_of_robots, int type_of_robots, vector<Coordinates>* robot_start_positions, string export_target_directory, bool print_outs, int simulation_engine, int telemetry_level, bool export_json, const SearchSettings* search_settings, int worker_threads){ // function to run a single robot simulation with passed in parameters
+                                                                                                                                                                                                                                               // at tl_Request turns are streamed to a binary trace, which is converted to Simulation.json and removed if export_json is set
+                                                                                                                                                                                                                                               // at tl_Summary and tl_Turn only the summary is exported to Simulation.json, at tl_Off nothing is exported
+                                                                                                                                                                                                                                               // Turn_Executor runs robots on up to worker_threads threads
+                                                                                                                                                                                                                                               // returns summary of simulation, empty at tl_Off
+                                                                                                                                                                                                                                               // exceptions thrown while simulating are passed on once simulation has been freed, trace and frames recorded so far are kept
+    if(!isRobotType(type_of_robots)){ // nothing has been allocated yet
+        throw "Critical Error: Unknown robot type";
+    }
 
-    std::filesystem::create_directories(target_directory + "printouts"); // creating directory to store printouts in  
+    // ~~~ Trace Creation ~~~
+    TraceWriter* Trace = NULL; // requests are only traced at tl_Request
 
-    for(int i = 0; i < (*strings_to_export).size(); i++){
-        string print_name = target_directory + "printouts/" + "printout_" + to_string(i+1) + ".txt"; // creating file in target_directory
+    if(telemetry_level >= tl_Request){
+        Trace = new TraceWriter(export_target_directory);
 
-        std::ofstream json_file(print_name); // creating file stream to the printouts to      
-        if(json_file.is_open()){ // if file was created successfully
-            json_file << (*strings_to_export)[i]; // export printout to txt file
+        if(!Trace->isOpen()){
+            cout << "Error: Failed to write trace to " << export_target_directory << "\n";
         }
     }
 
-    return;
-}
+    // ~~~ Frame Recorder Creation ~~~
+    FrameRecorder* Frames = NULL; // GlobalMap is only recorded when printouts are exported
+
+    if(print_outs && telemetry_level >= tl_Turn){
+        Frames = new FrameRecorder(export_target_directory, Generated_Maze->getMazeXSize(), Generated_Maze->getMazeYSize());
+
+        if(!Frames->isOpen()){
+            cout << "Error: Failed to write frames to " << export_target_directory << "\n";
+        }
+    }
+
+    // ~~~ Robot Master Generation ~~~
+    unsigned long start_message_allocations = getMessageSystemAllocations(); // tracking memory requested for messages by simulation
+                                                                             // shared counter, so simulations running at the same time are counted together
 
-void runSimulation(Maze* Generated_Maze, int number_of_robots, int type_of_robots, vector<Coordinates>* robot_start_positions, string export_target_directory, bool print_outs){ // function to run a single robot simulation with passed in parameters
-    // ~~~ Turn Tracking System Variable Creation ~~~~
-    TurnControlData turn_control_data(number_of_robots);
-    
-    // ~~~ Robot Master Thread Generation ~~~
     RequestHandler* request_handler = new RequestHandler(); // creating message handler for robot -> master communcation
     
     // gathering new RobotMaster compatible with specified type of robots
     RobotMaster* Robot_Master = getNewRobotMaster(type_of_robots, number_of_robots, request_handler, Generated_Maze->getMazeXSize(), Generated_Maze->getMazeYSize());
-    RobotMasterArgs RMArgs(Robot_Master, &turn_control_data);
+    Robot_Master->setRequestTracing(telemetry_level >= tl_Request);
+    Robot_Master->setPathPlanner(search_settings->path_planner);
+
+    if(search_settings->distance_oracle){
+        Robot_Master->enableDistanceOracle();
+    }
 
-    // creating thread to run Robot_Master 
-    pthread_t master_thread;
-    pthread_create(&master_thread, NULL, &masterFunc, (void*)&RMArgs);
+    SimulationArgs SimArgs(Robot_Master, Generated_Maze->getMazeMapPointer(), Trace, Frames, worker_threads);
 
-    // ~~~ Robot Thread Generation ~~~
-    MultiRobot* Robots_Array[number_of_robots]; // generating array for robots to be stored in
-    RobotArgs* Robot_Thread_Args[number_of_robots]; // generating array for arguments to be passed into robot threads
+    // ~~~ Robot Generation ~~~
+    SimArgs.robots.reserve(number_of_robots);
 
-    pthread_t thread_id[number_of_robots]; // creating threads for each robot              
-    
     for (int i = 0; i < number_of_robots; i++){
+        // gathering new robot of specified type and start position
+        SimArgs.robots.push_back(RobotTurnState(getNewRobot(type_of_robots, (*robot_start_positions)[i].x, (*robot_start_positions)[i].y, request_handler, Generated_Maze->getMazeXSize(), Generated_Maze->getMazeYSize())));
+        SimArgs.robots[i].Generated_Robot->setRandomSeed(i + 1); // every run of the same maze and start positions gives the same result
+        SimArgs.robots[i].Generated_Robot->setPathPlanner(search_settings->path_planner);
 
-        Robots_Array[i] = getNewRobot(type_of_robots, (*robot_start_positions)[i].x, (*robot_start_positions)[i].y, request_handler, Generated_Maze->getMazeXSize(), Generated_Maze->getMazeYSize()); // gathering new robot of specified type and start position
-        
-        // passing robot into
-        Robot_Thread_Args[i] = new RobotArgs(Robots_Array[i], Generated_Maze->getMazeMap(), &turn_control_data);
-        // running robot thread
-        pthread_create(&thread_id[i], NULL, &robotFunc, (void*)Robot_Thread_Args[i]);
+        if(type_of_robots != 6 && type_of_robots != 7){ // batch robots must request their targets from RobotMaster
+            SimArgs.robots[i].Generated_Robot->setFrontierSearchMode(search_settings->frontier_search);
+        }
     }
 
-    // ~~~ Awaiting Robot Thread Completion  ~~~
-    for(int i = 0; i < number_of_robots; i++) // waiting for robot threads to finish
-        pthread_join(thread_id[i], NULL); 
+    // lambda which frees everything allocated for simulation
+    auto deleteSimulation = [&](){
+        delete Trace; // closes trace and frames if they have not been closed
+        delete Frames;
 
-    // ~~~ Awaiting Robot Master Thread Completion ~~~
-    pthread_join(master_thread, NULL); // waiting for robot master thread to finish
+        delete Robot_Master; // deleting RobotMaster
     
-    exportJSON(RMArgs.turn_json, "Simulation", export_target_directory); // exporting json
-    if(print_outs == true) // if prinouts enabled
-        exportPrintOuts(&RMArgs.maze_printouts, export_target_directory); // exporting print outs
+        for(int i = 0; i < number_of_robots; i++){ // deleting all generated robots
+            delete SimArgs.robots[i].Generated_Robot;
+        }
+
+        delete request_handler; // deleting request handler used by robots
+    };
 
-    // ~~~ Deleting Dynamically Allocated Memory and Barriers ~~~
+    // ~~~ Running Simulation ~~~
+    try{
+        getSimulationFunction(simulation_engine, telemetry_level)(&SimArgs); // run on calling thread, which is a sweep worker when simulations run at once
+    }
+    catch(...){ // simulation failed, nothing more is exported
+        deleteSimulation();
+        throw;
+    }
 
-    delete Robot_Master; // deleting RobotMaster
+    if(telemetry_level >= tl_Summary){
+        SimArgs.summary["Info"]["Message_Blocks_Allocated"] = getMessageSystemAllocations() - start_message_allocations; // channels are reused by later simulations, so this is only non-zero for simulations busier than those before them
+    }
     
-    for(int i = 0; i < number_of_robots; i++) // deleting all generated robots
-        delete Robots_Array[i];
+    if(Trace != NULL){
+        Trace->writeInfo(SimArgs.summary);
+        Trace->close(); // waiting for every turn to be written
+
+        if(export_json && convertTraceToJSON(export_target_directory, export_target_directory + "Simulation.json")){ // exporting json in format expected by analysis scripts
+            std::filesystem::remove(export_target_directory + TRACE_REQUESTS_FILE); // trace is no longer needed
+            std::filesystem::remove(export_target_directory + TRACE_PATHS_FILE);
+            std::filesystem::remove(export_target_directory + TRACE_INFO_FILE);
+        }
+    }
+    else if(telemetry_level >= tl_Summary){
+        exportJSON(SimArgs.summary, "Simulation", export_target_directory); // Simulation.json only holds summary of simulation
+    }
+
+    if(Frames != NULL){
+        Frames->close(); // writing index of frames, printouts can then be exported with --export-printouts
+    }
+
+    // ~~~ Deleting Dynamically Allocated Memory ~~~
+    deleteSimulation();
+
+    return SimArgs.summary;
+}
+
+struct SweepJob{ // structure to hold settings of a single simulation within a sweep
+
+    int maze_size; // size of random maze generated for simulation
+    unsigned int maze_seed; // seed random maze is generated from
+    int maze_generator; // mg_ algorithm random maze is generated with
+    string maze_file; // maze file simulated instead of a random maze, empty to generate maze
+
+    int number_of_robots;
+    int type_of_robots;
+
+    vector<Coordinates> start_positions; // start position of each robot
+
+    string export_directory; // directory simulation results are exported to
+    bool print_outs; // whether printouts of GlobalMap are exported
+    bool export_json; // whether trace is converted to Simulation.json
+
+    json summary; // summary of simulation once it has been run, empty at tl_Off
+    string error; // reason simulation failed, empty if simulation was run
+
+    SweepJob(int size, unsigned int seed, int generator, int robots, int type, vector<Coordinates> positions, string directory, bool P, bool J, string file = ""){
+        maze_size = size;
+        maze_seed = seed;
+        maze_generator = generator;
+        maze_file = file;
+        number_of_robots = robots;
+        type_of_robots = type;
+        start_positions = positions;
+        export_directory = directory;
+        print_outs = P;
+        export_json = J;
+    }
+};
+
+void runSweep(vector<SweepJob>* jobs, int simulation_engine, int telemetry_level, int max_simulations_at_once, const SearchSettings* search_settings){ // runs every simulation of a sweep, up to max_simulations_at_once at the same time
+                                                                                                               // simulations are independent so they are spread over a pool of worker threads, progress and ETA are printed as each one finishes
+                                                                                                               // a simulation which fails has its error exported to Simulation_Error.json in its directory and the remaining simulations carry on
+    int number_of_jobs = jobs->size();
+
+    if(number_of_jobs == 0){
+        return;
+    }
+
+    if(max_simulations_at_once <= 0){ // using one simulation per hardware thread
+        max_simulations_at_once = std::max<int>(std::thread::hardware_concurrency(), 1);
+    }
+
+    TurnExecutor Executor(std::min(max_simulations_at_once, number_of_jobs)); // no more worker threads than simulations are needed
+
+    int worker_threads = std::max<int>(std::thread::hardware_concurrency(), 1); // hardware threads are shared between simulations running at once
+    worker_threads = std::max(worker_threads / Executor.getNumberofThreads(), 1);
+
+    pthread_mutex_t progress_lock = PTHREAD_MUTEX_INITIALIZER; // lock preventing progress of simulations finishing at the same time from being interleaved
+    int jobs_completed = 0;
+    int jobs_failed = 0;
+
+    auto sweep_start = std::chrono::steady_clock::now();
+
+    cout << "Running " << number_of_jobs << " simulations, " << Executor.getNumberofThreads() << " at a time\n";
+
+    std::function<void(int)> run_job = [&](int i){
+        SweepJob* Job = &(*jobs)[i];
+
+        Maze m;
+        Job->error.clear();
+
+        try{
+            bool maze_ready = true;
+
+            if(Job->maze_file.empty()){
+                m.generateRandomNxNMaze(Job->maze_size, Job->maze_size, Job->maze_seed, Job->maze_generator); // generating random maze of job
+            }
+            else{
+                maze_ready = m.loadMazeFile(Job->maze_file); // file could have been changed since experiment was started
+            }
+
+            std::filesystem::create_directories(Job->export_directory); // creating child directory to store robot simulation for this test
+
+            if(maze_ready){
+                Job->summary = runSimulation(&m, Job->number_of_robots, Job->type_of_robots, &Job->start_positions, Job->export_directory, Job->print_outs, simulation_engine, telemetry_level, Job->export_json, search_settings, worker_threads); // running simulation
+            }
+            else{
+                Job->error = "Failed to read maze from " + Job->maze_file;
+            }
+        }
+        catch(const char* e){ // repo's critical errors are thrown as strings
+            Job->error = e;
+        }
+        catch(const std::exception& e){
+            Job->error = e.what();
+        }
+        catch(...){
+            Job->error = "Unknown exception";
+        }
+
+        if(!Job->error.empty()){ // recording failure with simulation so it is not mistaken for a missing result
+            Job->summary = json();
+
+            try{
+                std::filesystem::create_directories(Job->export_directory);
+                exportJSON({{"Error", Job->error}}, "Simulation_Error", Job->export_directory);
+            }
+            catch(...){} // failure is still printed below if it cannot be exported
+        }
+
+        pthread_mutex_lock(&progress_lock);
+
+        if(!Job->error.empty()){
+            cout << "Error: " << Job->export_directory << " failed: " << Job->error << "\n";
+            jobs_failed++;
+        }
+
+        jobs_completed++;
+
+        double seconds_elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - sweep_start).count();
+        double seconds_remaining = seconds_elapsed / jobs_completed * (number_of_jobs - jobs_completed); // assuming remaining simulations take as long as completed ones on average
+
+        cout << "[" << jobs_completed << "/" << number_of_jobs << "] " << Job->export_directory << " done, elapsed " << (long)seconds_elapsed << "s, ETA " << (long)seconds_remaining << "s\n";
+
+        pthread_mutex_unlock(&progress_lock);
+    };
+
+    Executor.runPhase(number_of_jobs, run_job);
+
+    if(jobs_failed > 0){
+        cout << jobs_failed << "/" << number_of_jobs << " simulations failed, see Simulation_Error.json in their directories\n";
+    }
 
-    delete request_handler; // deleting request handler used by robots
+    pthread_mutex_destroy(&progress_lock);
 
     return;
 }
 
+bool checkEngines(vector<SweepJob>* jobs, string output_directory, int telemetry_level, int max_simulations_at_once, const SearchSettings* search_settings){ // runs every simulation of a sweep with each engine, returns false if engines take a different number of turns on any simulation
+                                                                                                                                                     // skipping idle turns must never change results, so each engine's results are exported to its own directory within output_directory
+    const int engines[] = {se_TurnExecutor, se_DiscreteEvent, se_Coroutine};
+    const string engine_names[] = {"Turn_Executor", "Discrete_Event", "Coroutine"};
+    const int number_of_engines = sizeof(engines)/sizeof(engines[0]);
+
+    vector<vector<SweepJob>> engine_jobs; // jobs of each engine, holding summary of each simulation once run
+
+    for(int e = 0; e < number_of_engines; e++){
+        engine_jobs.push_back(*jobs);
+
+        for(int i = 0; i < engine_jobs[e].size(); i++){ // directories of jobs are within output_directory
+            SweepJob* Job = &engine_jobs[e][i];
+            Job->export_directory = output_directory + engine_names[e] + "/" + Job->export_directory.substr(output_directory.size());
+        }
+
+        cout << "Checking " << engine_names[e] << "\n";
+
+        runSweep(&engine_jobs[e], engines[e], std::max(telemetry_level, tl_Summary), max_simulations_at_once, search_settings); // turns taken are only recorded from tl_Summary
+    }
+
+    auto getTurnsTaken = [](const SweepJob* Job){ // turns taken by simulation of job, null if it failed
+        if(!Job->summary.is_object()){
+            return json();
+        }
+
+        return Job->summary.value("Info", json::object()).value("Total_Turns_Taken", json());
+    };
+
+    int simulations_differing = 0;
+
+    for(int i = 0; i < jobs->size(); i++){ // comparing turns taken by each engine with the first engine
+        json turns_taken = getTurnsTaken(&engine_jobs[0][i]);
+
+        for(int e = 1; e < number_of_engines; e++){
+            json engine_turns_taken = getTurnsTaken(&engine_jobs[e][i]);
+
+            if(turns_taken.is_null() || engine_turns_taken != turns_taken){ // a simulation which did not finish never matches
+                cout << "Error: " << (*jobs)[i].export_directory << " took " << turns_taken << " turns with " << engine_names[0] << " and " << engine_turns_taken << " turns with " << engine_names[e] << "\n";
+                simulations_differing++;
+                break;
+            }
+        }
+    }
+
+    cout << jobs->size() - simulations_differing << "/" << jobs->size() << " simulations took the same number of turns with every engine\n";
+
+    return simulations_differing == 0;
+}
+
+vector<Coordinates> getGroupStartPositions(int maze_size, int robots_per_group, int number_of_groups, std::mt19937* rand_location){ // places each group of robots on a different random cell along the border of the maze
+                                                                                                                                    // number_of_groups must not be more than the number of border cells
+    vector<Coordinates> start_positions; // vector to store start positions for each robot
+
+    std::uniform_int_distribution<> dist(1, 2*maze_size + 2*(maze_size - 2)); // distribute random value between 1 and the number of border cells
+
+    for(int group_num = 0; group_num < number_of_groups; group_num++){ // generating robot start positions based on number of positions desited
+        
+        bool valid_location = false; // boolean to track whether the group's start location is valid
+    
+        while(!valid_location){ // while selected location is invalid
+            int chosen_location = dist(*rand_location); // choosing a random border cell
+            Coordinates chosen_start_position;
+
+            int xpos = 0; // tracks x position of selected cell
+            int ypos = 0; // tracks y position of selected cell
+            bool cell_found = false;
+
+            while(!cell_found){ // while the selected cell has not been found
+                
+                chosen_location--; // subtract 1 movement for locatoin selection
+
+                if(chosen_location == 0){ // if chosen location = 0, cell found
+                    cell_found = true;
+                    chosen_start_position = Coordinates(xpos,ypos);
+                }
+                else{ // if move movements around border of maze
+                    if(ypos == 0 && xpos < maze_size - 1){ // if on first on in maze
+                        xpos++; // move east
+                    }
+                    else if(xpos == maze_size - 1 && ypos < maze_size - 1){ // if on last column of maze
+                        ypos++; // move south
+                    }
+                    else if(ypos == maze_size - 1 && xpos > 0){ // if on last row of maze
+                        xpos--; // move west
+                    }
+                    else{ // if on first column of maze
+                        ypos--; // move north
+                    }
+                }
+            }
+
+            bool position_already_in_use = false; // checking if the chosen start location is already being used
+            for(int k = 0; k < start_positions.size(); k++){
+                if(chosen_start_position == start_positions[k]){
+                    position_already_in_use = true;
+                }
+            }
+
+            if(!position_already_in_use){ // if location already used
+                valid_location = true; // setting valid_location to true as a new group start position has been found
+                for(int k = 0; k < robots_per_group; k++) // adding start positions according to the number of robots in a group
+                    start_positions.push_back(chosen_start_position);
+            }
+        }
+    }
+
+    return start_positions;
+}
+
+int askSimulationEngine(){ // prompts for the engine simulations are run with, same choices as Simulation_Engine in experiment files
+
+    int simulation_engine;
+    cout << "Which simulation engine to use?\n";
+    cout << "0 - Turn Executor\n";
+    cout << "1 - Discrete Event\n";
+    cout << "2 - Coroutine\n";
+
+    while(!(cin >> simulation_engine) || (simulation_engine != se_TurnExecutor && simulation_engine != se_DiscreteEvent && simulation_engine != se_Coroutine)){ // asking again until a listed engine is entered
+        if(cin.eof()){ // no more input to read
+            throw "Critical Error: No simulation engine entered";
+        }
+
+        cin.clear(); // discarding rest of invalid line
+        cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+        cout << "Error: Simulation engine must be 0, 1 or 2\n";
+    }
+
+    return simulation_engine;
+}
+
+int askRobotType(){ // prompts for the type of robots to simulate, same choices as Robot_Types in experiment files
+
+    int robot_type;
+    cout << "What type of robots do you want to use?\n";
+    cout << "1 - Collision, Greedy\n";
+    cout << "2 - Collision, FCFS\n";
+    cout << "3 - No Collision, Greedy\n";
+    cout << "4 - No Collision, FCFS\n";
+
+    while(!(cin >> robot_type) || !isRobotType(robot_type)){ // asking again until a known type is entered
+        if(cin.eof()){ // no more input to read
+            throw "Critical Error: No robot type entered";
+        }
+
+        cin.clear(); // discarding rest of invalid line
+        cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+        cout << "Error: Robot type must be between 1 and 7\n";
+    }
+
+    return robot_type;
+}
+
 void simulateOneTime(){
     // ~~~ Maze Selection ~~~
     cout << "Which Maze would you like to simulate?\n";
     cout << "1 - 4x4 Sample Maze\n";
     cout << "2 - 8x8 Sample Maze\n";
     cout << "3 - NxN Random Maze\n";
+    cout << "4 - Maze File\n";
 
     int maze_selection_input; // variable to store input
 
@@ -374,6 +985,20 @@ void simulateOneTime(){
             Generated_Maze.generateRandomNxNMaze(x,x);
             Generated_Maze.printMaze();
             
+            break;
+        }
+        case 4:
+        {
+            string maze_file;
+            cout << "Enter the maze file to simulate:\n";
+            cin >> maze_file;
+
+            if(!Generated_Maze.loadMazeFile(maze_file)){
+                cout << "Error: Failed to read maze from " << maze_file << "\n";
+                return;
+            }
+            Generated_Maze.printMaze();
+
             break;
         }
     }
@@ -386,13 +1011,7 @@ void simulateOneTime(){
     cin >> number_of_robots;
 
     // determining type of robots to simulate
-    int type_of_robots = 0;
-    cout << "What type of robots do you want to use?\n";
-    cout << "1 - Collision, Greedy\n";
-    cout << "2 - Collision, FCFS\n";
-    cout << "3 - No Collision, Greedy\n";
-    cout << "4 - No Collision, FCFS\n";
-    cin >> type_of_robots;         
+    int type_of_robots = askRobotType();
     
     vector<Coordinates> start_positions; // vector to store start positions of robots
 
@@ -410,11 +1029,15 @@ void simulateOneTime(){
         start_positions.push_back(Coordinates(robot_x_position, robot_y_position)); // adding start coordinates
     }
 
+    int simulation_engine = askSimulationEngine();
+
     string target_directory; // directory for simulation info
     cout << "Enter a directory to store results of the simulation:\n";
     cin >> target_directory;   
 
-    runSimulation(&Generated_Maze, number_of_robots, type_of_robots, &start_positions, target_directory, true); // starting simulation with passed in settings
+    SearchSettings search_settings;
+
+    runSimulation(&Generated_Maze, number_of_robots, type_of_robots, &start_positions, target_directory, true, simulation_engine, tl_Request, true, &search_settings, std::max<int>(std::thread::hardware_concurrency(), 1)); // starting simulation with passed in settings
 
     return;
 }
@@ -433,13 +1056,7 @@ void testGroupSize(){
     cout << "How many robots to simulate?\n";
     cin >> number_of_robots;
 
-    int type_of_robots; // what type of robot to use in simulations
-    cout << "What type of robot to use?\n";
-    cout << "1 - Collision, Greedy\n";
-    cout << "2 - Collision, FCFS\n";
-    cout << "3 - No Collision, Greedy\n";
-    cout << "4 - No Collision, FCFS\n";
-    cin >> type_of_robots;
+    int type_of_robots = askRobotType(); // what type of robot to use in simulations
     
     // getting all factor pairs of the number of robots
     vector<pair<int,int>> group_sizes; // first = number of robots in group, second = number of start positions
@@ -449,6 +1066,12 @@ void testGroupSize(){
         }
     }
 
+    int simulation_engine = askSimulationEngine();
+
+    int max_simulations_at_once; // how many simulations can run at the same time
+    cout << "How many simulations to run at once? (0 - one per hardware thread)\n";
+    cin >> max_simulations_at_once;
+
     string target_directory; // getting target directory for simulation results
     cout << "Enter a directory to store results of the simulation:\n";
     cin >> target_directory;
@@ -465,78 +1088,27 @@ void testGroupSize(){
         simulation_info["Group_Sizes"].push_back(group_sizes[i].first); // adding group size to simulation_info json 
     }
 
+    vector<SweepJob> jobs; // every simulation of the sweep
+
     for(int j = 0; j < number_of_mazes; j++){
 
         for(int i = 0; i < group_sizes.size(); i++){
 
-            vector<Coordinates> start_positions; // vector to store start positions for each robot
-            
             std::random_device rd; // non-deterministic number generator
             std::mt19937 rand_location(rd()); // seeding mersenne twister
-            std::uniform_int_distribution<> dist(1, 2*maze_size + 2*(maze_size - 2)); // distribute random value between 1 and the number of border cells
-
-            for(int group_num = 0; group_num < group_sizes[i].second; group_num++){ // generating robot start positions based on number of positions desited
-                
-                bool valid_location = false; // boolean to track whether the group's start location is valid
-            
-                while(!valid_location){ // while selected location is invalid
-                    int chosen_location = dist(rand_location); // choosing a random border cell
-                    Coordinates chosen_start_position;
-
-                    int xpos = 0; // tracks x position of selected cell
-                    int ypos = 0; // tracks y position of selected cell
-                    bool cell_found = false;
-
-                    while(!cell_found){ // while the selected cell has not been found
-                        
-                        chosen_location--; // subtract 1 movement for locatoin selection
-
-                        if(chosen_location == 0){ // if chosen location = 0, cell found
-                            cell_found = true;
-                            chosen_start_position = Coordinates(xpos,ypos);
-                        }
-                        else{ // if move movements around border of maze
-                            if(ypos == 0 && xpos < maze_size - 1){ // if on first on in maze
-                                xpos++; // move east
-                            }
-                            else if(xpos == maze_size - 1 && ypos < maze_size - 1){ // if on last column of maze
-                                ypos++; // move south
-                            }
-                            else if(ypos == maze_size - 1 && xpos > 0){ // if on last row of maze
-                                xpos--; // move west
-                            }
-                            else{ // if on first column of maze
-                                ypos--; // move north
-                            }
-                        }
-                    }
-
-                    bool position_already_in_use = false; // checking if the chosen start location is already being used
-                    for(int k = 0; k < start_positions.size(); k++){
-                        if(chosen_start_position == start_positions[k]){
-                            position_already_in_use = true;
-                        }
-                    }
-
-                    if(!position_already_in_use){ // if location already used
-                        valid_location = true; // setting valid_location to true as a new group start position has been found
-                        for(int k = 0; k < group_sizes[i].first; k++) // adding start positions according to the number of robots in a group
-                            start_positions.push_back(chosen_start_position);
-                    }
-                }
-            }
-            
 
-            Maze m;
-            m.generateRandomNxNMaze(maze_size, maze_size); // generating new random maze
+            vector<Coordinates> start_positions = getGroupStartPositions(maze_size, group_sizes[i].first, group_sizes[i].second, &rand_location); // vector to store start positions for each robot
 
             string directory_for_export = target_directory + to_string(number_of_robots) + "_group_size_" + to_string(group_sizes[i].first) + "/sim_" + to_string(j + 1) +  "/"; // getting directory for target output
-            std::filesystem::create_directories(directory_for_export); // creating child directory to store robot simulation for this test
 
-            runSimulation(&m, number_of_robots, type_of_robots, &start_positions, directory_for_export, false); // running simulation
+            jobs.push_back(SweepJob(maze_size, rd(), mg_AldousBroder, number_of_robots, type_of_robots, start_positions, directory_for_export, false, true)); // maze is generated once simulation is run
         }
     }
 
+    SearchSettings search_settings;
+
+    runSweep(&jobs, simulation_engine, tl_Request, max_simulations_at_once, &search_settings); // running simulations
+
     exportJSON(simulation_info, "Sim_Settings", target_directory); // exporting simulation settings json
 
     return;
@@ -560,13 +1132,13 @@ void testSwarmSize(){
     cout << "What is maximum number of robots to simulate?\n";
     cin >> max_number_of_robots;
     
-    int type_of_robots; // type of robot to simulate
-    cout << "What type of robot to use?\n";
-    cout << "1 - Collision, Greedy\n";
-    cout << "2 - Collision, FCFS\n";
-    cout << "3 - No Collision, Greedy\n";
-    cout << "4 - No Collision, FCFS\n";
-    cin >> type_of_robots;
+    int type_of_robots = askRobotType(); // type of robot to simulate
+
+    int simulation_engine = askSimulationEngine();
+
+    int max_simulations_at_once; // how many simulations can run at the same time
+    cout << "How many simulations to run at once? (0 - one per hardware thread)\n";
+    cin >> max_simulations_at_once;
 
     string target_directory; // getting target directory for simulation results
     cout << "Enter a directory to store results of the simulation:\n";
@@ -585,30 +1157,449 @@ void testSwarmSize(){
 
     vector<Coordinates> start_positions(max_number_of_robots, Coordinates(0,0));
 
-    for(int j = 0; j < number_of_mazes; j++){ // for loops to run simulations
+    std::random_device rd; // non-deterministic number generator used to seed mazes
+
+    vector<SweepJob> jobs; // every simulation of the sweep
+
+    for(int j = 0; j < number_of_mazes; j++){ // for loops to gather simulations
 
         for(int i = min_number_of_robots; i <= max_number_of_robots; i++){
-            
-            Maze m;
-            m.generateRandomNxNMaze(maze_size, maze_size); // generating new random maze
 
             string directory_for_export = target_directory + "sim_size_" + to_string(i) + "/sim_" + to_string(j + 1) +  "/"; // getting directory for target output
-            std::filesystem::create_directories(directory_for_export); // creating child directory to store robot simulation for this test
 
-            runSimulation(&m, i, type_of_robots, &start_positions, directory_for_export, false); // running simulation
+            jobs.push_back(SweepJob(maze_size, rd(), mg_AldousBroder, i, type_of_robots, start_positions, directory_for_export, false, true)); // maze is generated once simulation is run
         }
     }
 
+    SearchSettings search_settings;
+
+    runSweep(&jobs, simulation_engine, tl_Request, max_simulations_at_once, &search_settings); // running simulations
+
     exportJSON(simulation_info, "Sim_Settings", target_directory); // exporting simulation settings json
 
     return;
 }
 
-int main(){
+int getSimulationEngine(string engine_name){ // converts name of a simulation engine used in experiment files to its macro, -1 if name is unknown
+
+    if(engine_name == "Turn_Executor"){
+        return se_TurnExecutor;
+    }
+    else if(engine_name == "Discrete_Event"){
+        return se_DiscreteEvent;
+    }
+    else if(engine_name == "Coroutine"){
+        return se_Coroutine;
+    }
+
+    return -1;
+}
+
+int getTelemetryLevel(string level_name){ // converts name of a telemetry level used in experiment files to its macro, -1 if name is unknown
+
+    if(level_name == "Off"){
+        return tl_Off;
+    }
+    else if(level_name == "Summary"){
+        return tl_Summary;
+    }
+    else if(level_name == "Turn"){
+        return tl_Turn;
+    }
+    else if(level_name == "Request"){
+        return tl_Request;
+    }
+
+    return -1;
+}
+
+int getMazeGenerator(string generator_name){ // converts name of a maze generator used in experiment files and on the command line to its macro, -1 if name is unknown
+
+    if(generator_name == "Aldous_Broder"){
+        return mg_AldousBroder;
+    }
+    else if(generator_name == "Wilson"){
+        return mg_Wilson;
+    }
+    else if(generator_name == "Backtracker"){
+        return mg_Backtracker;
+    }
+    else if(generator_name == "Eller"){
+        return mg_Eller;
+    }
+
+    return -1;
+}
+
+int getFrontierSearchMode(string mode_name){ // converts name of a nearest unknown cell search used in experiment files to its macro, -1 if name is unknown
+
+    if(mode_name == "BFS"){
+        return fs_BFS;
+    }
+    else if(mode_name == "Incremental_BFS"){
+        return fs_IncrementalBFS;
+    }
+    else if(mode_name == "Master_Field"){
+        return fs_MasterField;
+    }
+
+    return -1;
+}
+
+int getPathPlanner(string planner_name){ // converts name of a point to point planner used in experiment files to its macro, -1 if name is unknown
+
+    if(planner_name == "BFS"){
+        return pp_BFS;
+    }
+    else if(planner_name == "A_Star"){
+        return pp_AStar;
+    }
+
+    return -1;
+}
+
+int getImageFormat(string format_name){ // converts name of an image format used on the command line to its macro, -1 if name is unknown
+
+    if(format_name == "gif"){
+        return if_GIF;
+    }
+    else if(format_name == "png"){
+        return if_PNG;
+    }
+    else if(format_name == "ppm"){
+        return if_PPM;
+    }
+
+    return -1;
+}
+
+bool runExperiment(string experiment_file, bool check_engines){ // runs every simulation described by an experiment file without any prompts
+                                                                // every combination of maze size, robot type, swarm size, start position strategy and seed is simulated
+                                                                // if check_engines is set, every simulation is run with each engine instead of Simulation_Engine, see checkEngines
+                                                                // returns false if experiment file could not be read or is invalid, or engines gave different results
+    std::ifstream file(experiment_file);
+
+    if(!file.is_open()){
+        cout << "Error: Failed to open " << experiment_file << "\n";
+        return false;
+    }
+
+    json experiment;
+
+    string output_directory;
+    string maze_file;
+    vector<int> maze_sizes, robot_types, swarm_sizes, group_sizes;
+    vector<string> start_strategies;
+    vector<unsigned int> seeds;
+    bool print_outs;
+    bool export_json;
+    int simulation_engine;
+    int telemetry_level;
+    int maze_generator;
+    int max_simulations_at_once;
+    SearchSettings search_settings;
+
+    try{ // gathering settings, optional settings are given defaults
+        experiment = json::parse(file);
+
+        output_directory = experiment.at("Output_Directory").get<string>();
+        maze_file = experiment.value("Maze_File", string(""));
+        maze_sizes = maze_file.empty() ? experiment.at("Maze_Sizes").get<vector<int>>() : vector<int>(); // size of a maze file is read from the file
+        robot_types = experiment.at("Robot_Types").get<vector<int>>();
+        swarm_sizes = experiment.at("Swarm_Sizes").get<vector<int>>();
+        start_strategies = experiment.value("Start_Positions", vector<string>{"Corner"});
+        group_sizes = experiment.value("Group_Sizes", vector<int>{1});
+        print_outs = experiment.value("Print_Outs", false);
+        export_json = experiment.value("Export_Simulation_JSON", true);
+        simulation_engine = getSimulationEngine(experiment.value("Simulation_Engine", string("Discrete_Event")));
+        telemetry_level = getTelemetryLevel(experiment.value("Telemetry", string("Request")));
+        maze_generator = getMazeGenerator(experiment.value("Maze_Generator", string("Aldous_Broder")));
+        max_simulations_at_once = experiment.value("Simulations_at_Once", 0);
+        search_settings.frontier_search = getFrontierSearchMode(experiment.value("Frontier_Search", string("Incremental_BFS")));
+        search_settings.path_planner = getPathPlanner(experiment.value("Path_Planner", string("A_Star")));
+        search_settings.distance_oracle = experiment.value("Distance_Oracle", true);
+
+        if(experiment.contains("Seeds")){
+            seeds = experiment["Seeds"].get<vector<unsigned int>>();
+        }
+        else{ // picking a random seed for each maze, seeds are saved with results so experiment can be repeated
+            std::random_device rd;
+
+            for(int i = 0; i < experiment.value("Number_of_Mazes", 1); i++){
+                seeds.push_back(rd());
+            }
+
+            experiment["Seeds"] = seeds;
+        }
+    }
+    catch(json::exception& e){
+        cout << "Error: Invalid experiment file " << experiment_file << ", " << e.what() << "\n";
+        return false;
+    }
+
+    if(!maze_file.empty()){ // every simulation is run on the maze held in the file
+        Maze File_Maze;
+
+        if(!File_Maze.loadMazeFile(maze_file)){
+            cout << "Error: Failed to read maze from Maze_File " << maze_file << "\n";
+            return false;
+        }
+
+        if(File_Maze.getMazeXSize() != File_Maze.getMazeYSize()){ // start positions are picked for NxN mazes
+            cout << "Error: Maze_File must hold an NxN maze\n";
+            return false;
+        }
+
+        maze_sizes.push_back(File_Maze.getMazeXSize());
+    }
+
+    // ~~~ Validating Settings ~~~
+    for(int i = 0; i < maze_sizes.size(); i++){
+        if(maze_sizes[i] < 2){
+            cout << "Error: Maze_Sizes must be at least 2\n";
+            return false;
+        }
+    }
+
+    for(int i = 0; i < robot_types.size(); i++){
+        if(!isRobotType(robot_types[i])){
+            cout << "Error: Robot_Types must be between 1 and 7\n";
+            return false;
+        }
+    }
+
+    for(int i = 0; i < swarm_sizes.size(); i++){
+        if(swarm_sizes[i] < 1){
+            cout << "Error: Swarm_Sizes must be at least 1\n";
+            return false;
+        }
+    }
+
+    for(int i = 0; i < group_sizes.size(); i++){
+        if(group_sizes[i] < 1){
+            cout << "Error: Group_Sizes must be at least 1\n";
+            return false;
+        }
+    }
+
+    for(int i = 0; i < start_strategies.size(); i++){
+        if(start_strategies[i] != "Corner" && start_strategies[i] != "Random" && start_strategies[i] != "Border_Groups"){
+            cout << "Error: Unknown start position strategy " << start_strategies[i] << ", must be Corner, Random or Border_Groups\n";
+            return false;
+        }
+    }
+
+    if(simulation_engine < 0){
+        cout << "Error: Simulation_Engine must be Turn_Executor, Discrete_Event or Coroutine\n";
+        return false;
+    }
+
+    if(telemetry_level < 0){
+        cout << "Error: Telemetry must be Off, Summary, Turn or Request\n";
+        return false;
+    }
+
+    if(maze_generator < 0){
+        cout << "Error: Maze_Generator must be Aldous_Broder, Wilson, Backtracker or Eller\n";
+        return false;
+    }
+
+    if(search_settings.frontier_search < 0){
+        cout << "Error: Frontier_Search must be BFS, Incremental_BFS or Master_Field\n";
+        return false;
+    }
+
+    if(search_settings.frontier_search == fs_MasterField && std::find(robot_types.begin(), robot_types.end(), 5) != robot_types.end()){ // robots without cell reservation cannot be given a target by RobotMaster
+        cout << "Error: Frontier_Search cannot be Master_Field for Robot_Types 5\n";
+        return false;
+    }
+
+    if(search_settings.path_planner < 0){
+        cout << "Error: Path_Planner must be BFS or A_Star\n";
+        return false;
+    }
+
+    if(output_directory.empty() || output_directory.back() != '/'){ // directories are appended to output directory
+        output_directory += "/";
+    }
+
+    // ~~~ Expanding Parameter Grid ~~~
+    vector<SweepJob> jobs; // every simulation of the experiment
+    int combinations_skipped = 0;
+
+    for(int seed_num = 0; seed_num < seeds.size(); seed_num++){
+        for(int size_num = 0; size_num < maze_sizes.size(); size_num++){
+            for(int type_num = 0; type_num < robot_types.size(); type_num++){
+                for(int swarm_num = 0; swarm_num < swarm_sizes.size(); swarm_num++){
+                    for(int strategy_num = 0; strategy_num < start_strategies.size(); strategy_num++){
+
+                        unsigned int seed = seeds[seed_num];
+                        int maze_size = maze_sizes[size_num];
+                        int type_of_robots = robot_types[type_num];
+                        int number_of_robots = swarm_sizes[swarm_num];
+                        string strategy = start_strategies[strategy_num];
+
+                        vector<int> strategy_group_sizes = (strategy == "Border_Groups") ? group_sizes : vector<int>{number_of_robots}; // only groups along the border depend on group size
+
+                        for(int group_num = 0; group_num < strategy_group_sizes.size(); group_num++){
+
+                            int group_size = strategy_group_sizes[group_num];
+                            std::mt19937 rand_location(seed); // start positions are picked from same seed as maze so they can be repeated
+                            vector<Coordinates> start_positions;
+
+                            string directory_for_export = output_directory + "maze_" + to_string(maze_size) + "/type_" + to_string(type_of_robots) + "/robots_" + to_string(number_of_robots) + "/" + strategy;
+
+                            if(strategy == "Corner"){ // every robot starts in top left cell
+                                start_positions = vector<Coordinates>(number_of_robots, Coordinates(0,0));
+                            }
+                            else if(strategy == "Random"){ // every robot starts in its own random cell
+                                std::uniform_int_distribution<> dist(0, maze_size - 1);
+
+                                for(int i = 0; i < number_of_robots; i++){
+                                    int x = dist(rand_location);
+                                    int y = dist(rand_location);
+                                    start_positions.push_back(Coordinates(x, y));
+                                }
+                            }
+                            else{ // robots are split into groups, each starting in a different random cell along the border
+                                if(number_of_robots % group_size != 0 || number_of_robots / group_size > 4*maze_size - 4){ // robots cannot be split evenly into groups or there are not enough border cells
+                                    combinations_skipped++;
+                                    continue;
+                                }
+
+                                start_positions = getGroupStartPositions(maze_size, group_size, number_of_robots / group_size, &rand_location);
+                                directory_for_export += "_" + to_string(group_size);
+                            }
+
+                            directory_for_export += "/seed_" + to_string(seed) + "/";
+
+                            json run_info;
+                            run_info["Directory"] = directory_for_export;
+                            run_info["Maze_Size"] = maze_size;
+                            run_info["Seed"] = seed;
+                            if(maze_file.empty()){
+                                run_info["Maze_Generator"] = experiment.value("Maze_Generator", string("Aldous_Broder"));
+                            }
+                            else{
+                                run_info["Maze_File"] = maze_file;
+                            }
+                            run_info["Robot_Type"] = type_of_robots;
+                            run_info["Number_of_Robots"] = number_of_robots;
+                            run_info["Start_Positions"] = strategy;
+                            if(strategy == "Border_Groups"){
+                                run_info["Group_Size"] = group_size;
+                            }
+                            experiment["Runs"].push_back(run_info); // listing run so results can be found without knowing directory layout
+
+                            jobs.push_back(SweepJob(maze_size, seed, maze_generator, number_of_robots, type_of_robots, start_positions, directory_for_export, print_outs, export_json, maze_file));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if(combinations_skipped > 0){
+        cout << combinations_skipped << " combinations skipped as robots cannot be split evenly into groups along the border\n";
+    }
+
+    std::filesystem::create_directories(output_directory);
+    exportJSON(experiment, "Experiment", output_directory); // exporting expanded experiment before running so an interrupted experiment can still be inspected
+
+    if(check_engines){
+        return checkEngines(&jobs, output_directory, telemetry_level, max_simulations_at_once, &search_settings);
+    }
+
+    runSweep(&jobs, simulation_engine, telemetry_level, max_simulations_at_once, &search_settings); // running simulations
+
+    return true;
+}
+
+int main(int argc, char* argv[]){
     // ~~~ Title printouts ~~~
     cout << "~~~ Multi-agent Robot Simulator ~~~\n";
     cout << "Created by Ryan Wiebe\n";
     cout << "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+    if(argc > 2 && string(argv[1]) == "--convert-trace"){ // converting trace of a simulation to Simulation.json
+        string trace_directory = argv[2];
+
+        if(trace_directory.back() != '/'){
+            trace_directory += "/";
+        }
+
+        string json_file = (argc > 3) ? argv[3] : trace_directory + "Simulation.json"; // placing Simulation.json next to trace by default
+
+        if(!convertTraceToJSON(trace_directory, json_file)){
+            cout << "Error: Failed to convert trace in " << trace_directory << " to " << json_file << "\n";
+            return 1;
+        }
+
+        return 0;
+    }
+    else if(argc > 2 && string(argv[1]) == "--export-printouts"){ // rendering frames of a simulation to printouts/printout_<n>.txt
+        string frame_directory = argv[2];
+
+        if(frame_directory.back() != '/'){
+            frame_directory += "/";
+        }
+
+        if(!exportFramePrintOuts(frame_directory)){
+            cout << "Error: Failed to export printouts from frames in " << frame_directory << "\n";
+            return 1;
+        }
+
+        return 0;
+    }
+    else if(argc > 2 && string(argv[1]) == "--render-frames"){ // rendering frames of a simulation to an animated gif or to one image per frame
+        string frame_directory = argv[2];
+
+        if(frame_directory.back() != '/'){
+            frame_directory += "/";
+        }
+
+        int image_format = (argc > 3) ? getImageFormat(argv[3]) : if_GIF;
+        int cell_size = (argc > 4) ? atoi(argv[4]) : RENDER_CELL_SIZE;
+
+        if(image_format < 0 || cell_size < 2){
+            cout << "Error: Usage is --render-frames <directory> [gif|png|ppm] [pixels per cell, at least 2]\n";
+            return 1;
+        }
+
+        if(!renderFrames(frame_directory, image_format, cell_size, 0)){
+            cout << "Error: Failed to render frames in " << frame_directory << "\n";
+            return 1;
+        }
+
+        return 0;
+    }
+    else if(argc > 5 && string(argv[1]) == "--generate-maze"){ // generating a random maze straight to a maze file without simulating it
+        string maze_file = argv[2];
+        int x_size = atoi(argv[3]);
+        int y_size = atoi(argv[4]);
+        unsigned int seed = strtoul(argv[5], NULL, 10);
+        int generator_type = (argc > 6) ? getMazeGenerator(argv[6]) : mg_Eller; // Eller's algorithm streams rows so mazes larger than memory can be generated
+
+        if(x_size < 2 || y_size < 2 || generator_type < 0){ // same smallest maze as experiment files
+            cout << "Error: Usage is --generate-maze <file> <x size, at least 2> <y size, at least 2> <seed> [Aldous_Broder|Wilson|Backtracker|Eller]\n";
+            return 1;
+        }
+
+        if(!generateMazeFile(maze_file, x_size, y_size, seed, generator_type)){
+            cout << "Error: Failed to write maze to " << maze_file << "\n";
+            return 1;
+        }
+
+        return 0;
+    }
+    else if(argc > 2 && string(argv[1]) == "--check-engines"){ // running an experiment with every engine and comparing turns taken
+        return runExperiment(argv[2], true) ? 0 : 1;
+    }
+    else if(argc > 1){ // experiment file passed on command line, running it without prompts
+        return runExperiment(argv[1], false) ? 0 : 1;
+    }
+
+
     cout << "Which of the following would you like to simulate?\n";
     cout << "1 - One time Simulation\n";
     cout << "2 - Test Effects of Swarm Size on Mapping Speed\n";